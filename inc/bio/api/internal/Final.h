@@ -32,7 +32,8 @@ namespace bio {
  * This inhibition of extensibility is done to remove unnecessary impositions on downstream consumers of your code (i.e. it makes your code cleaner). <br />
  * Thus, only use Final<> if and only if you are USING rather than EXTENDING this library. <br />
  * <br />
- * NOTE: CLASS MUST be a child of chemical::Substance. This will be all classes users (and not developers) are likely to want.
+ * NOTE: CLASS MUST be a child of chemical::Substance. This will be all classes users (and not developers) are likely to want. <br />
+ * The CLASS held by *this is constructed in place; it is never copied from a temporary. <br />
  */
 template < class CLASS>
 class Final :
@@ -44,7 +45,7 @@ public:
 	 *
 	 */
 	Final() :
-		TransparentWrapper< CLASS >(CLASS())
+		TransparentWrapper< CLASS >(InPlace())
 	{
 	}
 
@@ -52,7 +53,10 @@ public:
 	 * @param name
 	 */
 	explicit Final(const Name& name):
-		TransparentWrapper< CLASS >(CLASS(name))
+		TransparentWrapper< CLASS >(
+			InPlace(),
+			name
+		)
 	{
 	}
 
@@ -60,10 +64,31 @@ public:
 	 * @param id
 	 */
 	explicit Final(const Id& id):
-		TransparentWrapper< CLASS >(CLASS(id))
+		TransparentWrapper< CLASS >(
+			InPlace(),
+			id
+		)
 	{
 	}
 
+	#if BIO_CPP_VERSION >= 11
+	/**
+	 * Construct the CLASS held by *this from whatever arguments it takes. <br />
+	 * @param args
+	 */
+	template < typename... ARGS >
+	explicit Final(
+		InPlace inPlace,
+		ARGS&&... args
+	):
+		TransparentWrapper< CLASS >(
+			inPlace,
+			::std::forward< ARGS >(args)...
+		)
+	{
+	}
+	#endif
+
 	/**
 	 *
 	 */
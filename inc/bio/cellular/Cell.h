@@ -81,7 +81,8 @@ public:
 	virtual Code ExpressGenes();
 
 	/**
-	 * Traverse up the Environment hierarchy to see if the given Tissue is anywhere above *this. <br />
+	 * Check if the given Tissue is anywhere above *this in the Environment hierarchy. <br />
+	 * This uses the cached ancestry of the Tissue *this is in (see Tissue::GetAncestry()). <br />
 	 * @param tissueId
 	 * @return whether or not the given Tissue contains *this or another Tissue which does. <br />
 	 */
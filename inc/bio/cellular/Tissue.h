@@ -31,6 +31,8 @@
 #include "bio/chemical/EnvironmentDependent.h"
 #include "bio/chemical/structure/motif/DependentMotif.h"
 
+#include <vector>
+
 namespace bio {
 namespace cellular {
 
@@ -59,7 +61,7 @@ public:
 	/**
 	 * Standard constructors. <br />
 	 */
-	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS(
+	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS_WITH_COMMON_CONSTRUCTOR(
 		cellular,
 		Tissue,
 		filter::Cellular()
@@ -85,19 +87,63 @@ public:
 	virtual void SetEnvironment(Tissue *environment);
 
 	/**
-	 * Traverse up the Environment hierarchy to see if the given Tissue is anywhere above *this. <br />
+	 * Check if the given Tissue is anywhere above *this in the Environment hierarchy. <br />
+	 * The Ids of all Tissues above *this are cached, so this does not traverse the hierarchy unless it has changed (see GetAncestry()). <br />
 	 * @param tissueId
 	 * @return whether or not the given Tissue contains *this or another Tissue which does. <br />
 	 */
 	virtual bool IsWithinTissue(const Id& tissueId) const;
 
 	/**
-	 * Traverse up the Environment hierarchy to see if the given Tissue is anywhere above *this. <br />
+	 * Check if the given Tissue is anywhere above *this in the Environment hierarchy. <br />
+	 * When checking many Cells or Tissues, prefer getting the Id once and using the Id overload. <br />
 	 * @param name
 	 * @return whether or not the given Tissue contains *this or another Tissue which does. <br />
 	 */
 	virtual bool IsWithinTissue(const Name& name) const;
 
+	/**
+	 * Get the Ids of all Tissues above *this, sorted by Id. <br />
+	 * These are cached until the Environment of *this or of a Tissue above *this changes; changes elsewhere in the hierarchy do not affect *this. <br />
+	 * NOTE: changing the Id of a Tissue will not update the cache of the Tissues below it. <br />
+	 * @return a copy of the Ids of all Tissues which contain *this.
+	 */
+	::std::vector< Id > GetAncestry() const;
+
+	/**
+	 * @return how many Tissues are above *this (i.e. 0 for a Tissue without an Environment).
+	 */
+	::std::size_t GetDepth() const;
+
+protected:
+
+	/**
+	 * Set up members. <br />
+	 */
+	void CommonConstructor();
+
+	/**
+	 * Invalidates the ancestry of *this and all Tissues below *this. <br />
+	 * @param environment
+	 */
+	virtual void EnvironmentChanged(Tissue* environment);
+
+	/**
+	 * Mark mAncestry as needing to be rebuilt, here and in every Tissue below *this. <br />
+	 * Stops at Tissues which are already stale, since nothing below a stale Tissue can have been rebuilt since it went stale. <br />
+	 */
+	void InvalidateAncestry();
+
+	/**
+	 * Rebuild mAncestry from the Environment of *this, if it has been Invalidated. <br />
+	 * A valid cache needs no checks beyond *this; a stale one only asks its Environment (which only rebuilds itself if stale too). <br />
+	 * Assumes *this is locked. <br />
+	 */
+	void CacheAncestry() const;
+
+	mutable ::std::vector< Id > mAncestry;
+	mutable ::std::size_t mDepth;
+	mutable bool mAncestryIsStale;
 };
 
 } //cellular namespace
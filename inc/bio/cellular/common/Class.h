@@ -66,7 +66,6 @@ public:
 			filter
 		)
 	{
-
 	}
 
 	/**
@@ -161,9 +160,15 @@ public:
 	 * If derived classes must do slow work to Crest, that slow logic MUST BE placed in a separate thread. <br />
 	 * This method would then get the data stored by that thread and returns the data *quickly*. MAKE SURE that the thread never causes a long mutex wait as a side-effect in this Crest method. <br />
 	 * Please call this method when you're done :) <br />
+	 * If *this DiffusesSolutes() (off by default; see chemical::Solution::SetDiffusesSolutes()), this also Diffuses the Interval Solutes of *this which are due, all at once. <br />
 	 */
 	virtual Code Crest()
 	{
+		chemical::Solution* solution = this;
+		if (solution->DiffusesSolutes())
+		{
+			solution->Diffuse();
+		}
 		return (*mcCrest)();
 	}
 
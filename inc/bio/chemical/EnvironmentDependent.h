@@ -76,9 +76,20 @@ public:
 	virtual void SetEnvironment(T environment)
 	{
 		mEnvironment = environment;
+		EnvironmentChanged(environment);
 	}
 
 protected:
+	/**
+	 * Called by SetEnvironment(), even when it is called non-virtually (e.g. by DependentMotif). <br />
+	 * Override this to be told when *this is moved to another environment. <br />
+	 * @param environment the new mEnvironment.
+	 */
+	virtual void EnvironmentChanged(T /*environment*/)
+	{
+
+	}
+
 	T mEnvironment;
 };
 
@@ -79,7 +79,7 @@ public:
 		const Container* container = GetAll< physical::Attraction< T > >();
 		BIO_SANITIZE(container,,return 0.0f;)
 		Index index = container->SeekTo(physical::Attraction< T >(t));
-		if (container->IsAllocated(index)) {
+		if (!container->IsAllocated(index)) {
 			return 0.0f;
 		}
 		return container->Access(index).template As< physical::Attraction< T > >().GetForce();
@@ -37,6 +37,12 @@
 #include "Bond.h"
 
 namespace bio {
+namespace physical {
+class Line;
+template < typename DIMENSION >
+class Identifiable;
+} //physical namespace
+
 namespace chemical {
 
 class Symmetry;
@@ -399,6 +405,27 @@ public:
 	 */
 	const Bonds* GetAllBonds() const;
 
+	/**
+	 * Motifs which hold Waves (e.g. LinearMotifs) override this to expose their contents. <br />
+	 * This allows whole objects to be walked (e.g. by chemical::Snapshot) without knowing their types. <br />
+	 * @return the physical::Line *this holds or NULL.
+	 */
+	virtual physical::Line* GetLinearContents();
+
+	/**
+	 * Motifs which hold Waves (e.g. LinearMotifs) override this to expose their contents. <br />
+	 * @return the physical::Line *this holds or NULL.
+	 */
+	virtual const physical::Line* GetLinearContents() const;
+
+	/**
+	 * Motifs which hold Waves (e.g. LinearMotifs) override this to add Contents they did not create. <br />
+	 * This allows whole objects to be rebuilt (e.g. by chemical::Snapshot) without knowing their types. <br />
+	 * @param content
+	 * @return content, as it is now held by *this, or NULL, if it could not be added.
+	 */
+	virtual physical::Identifiable< Id >* AddLinearContent(physical::Wave* content);
+
 	/**
 	 * Create a Bond. <br />
 	 * This is public for use in constructors. <br />
@@ -88,6 +88,13 @@ typedef uint16_t AtomicNumber;
  */
 typedef uint16_t Concentration;
 
+/**
+ * Revisions mark the structural state of a Motif. <br />
+ * Each time the Contents of a Motif change, the Motif is given a new, globally unique Revision. <br />
+ * Anything that caches pointers into a Motif (e.g. genetic::Localization) can compare Revisions to know if its cache is still valid. <br />
+ */
+typedef uint32_t Revision;
+
 class Substance;
 typedef ::bio::Arrangement< Substance* > Substances;
 
@@ -0,0 +1,137 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2023 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "Mix.h"
+#include "bio/common/thread/ThreadSafe.h"
+#include "bio/common/macro/SingletonMacros.h"
+
+#include <map>
+#include <vector>
+
+namespace bio {
+namespace chemical {
+
+/**
+ * The MiscibilityMatrix remembers which Miscibilities apply when Mixing one kind of Substance into another. <br />
+ * Substances are grouped by the set of Properties they have; each distinct set is given a small id. <br />
+ * Since Properties are Recorded per type (see PeriodicTable), the id of each type's set is remembered, by the Id of the Symmetry named for that type (see chemical::Class). <br />
+ * So, once a pair of types has been seen, Mixing them is just 2 array lookups. <br />
+ * <br />
+ * *this is Cleared automatically whenever the MiscibilityPerspective gains or loses a Miscibility, or the PeriodicTable Records new Properties. <br />
+ */
+class MiscibilityMatrix :
+	virtual public ThreadSafe
+{
+public:
+
+	/**
+	 *
+	 */
+	MiscibilityMatrix();
+
+	/**
+	 *
+	 */
+	virtual ~MiscibilityMatrix();
+
+	/**
+	 * Add the Miscibilities to apply when Mixing source into target to those given. <br />
+	 * @param target
+	 * @param source
+	 * @param miscibilities what to fill; not cleared.
+	 */
+	void GetMiscibilities(
+		const Substance* target,
+		const Substance* source,
+		Mix::Miscibilities& miscibilities
+	);
+
+	/**
+	 * Forget everything in *this. <br />
+	 */
+	void Clear();
+
+protected:
+
+	typedef ::std::vector< Property::Type > PropertySet;
+	typedef ::std::map< PropertySet, Index > PropertySetIds;
+
+	/**
+	 * The Miscibilities for 1 pair of PropertySets. <br />
+	 */
+	struct Entry
+	{
+		Entry();
+
+		bool mFound;
+		Mix::Miscibilities mMiscibilities;
+	};
+
+	typedef ::std::vector< ::std::vector< Entry > > Matrix;
+
+	/**
+	 * Clear() *this if the MiscibilityPerspective or the Properties in the PeriodicTable have changed since *this was filled. <br />
+	 * Must be called while *this is locked. <br />
+	 */
+	void CheckForChanges();
+
+	/**
+	 * Must be called while *this is locked. <br />
+	 * @param substance
+	 * @return the id of the PropertySet of the given Substance, creating one if needed.
+	 */
+	Index GetPropertySetIdOf(const Substance* substance);
+
+	/**
+	 * Must be called while *this is locked. <br />
+	 * @param properties in the order they were Gotten.
+	 * @return the id of the given PropertySet, creating one if needed.
+	 */
+	Index GetPropertySetId(const PropertySet& properties);
+
+	/**
+	 * Must be called while *this is locked. <br />
+	 * @param target
+	 * @param source
+	 * @return the Entry for Mixing the source PropertySet into the target PropertySet, Found.
+	 */
+	const Entry& GetEntry(
+		Index target,
+		Index source
+	);
+
+	PropertySetIds mPropertySetIds; //sorted PropertySet -> id.
+	::std::vector< PropertySet > mSortedSets; //by id.
+	::std::vector< PropertySet > mOrderedSets; //by id; the order Miscibilities are applied in.
+	::std::vector< Index > mTypeSetIds; //by Symmetry Id; InvalidIndex() if not yet seen.
+	Matrix mMatrix; //[target][source]
+	uint32_t mGeneration;
+	uint32_t mTypeGeneration;
+	uint32_t mPropertiesGeneration;
+};
+
+BIO_SINGLETON(GlobalMiscibilityMatrix, MiscibilityMatrix)
+
+} //chemical namespace
+} //bio namespace
@@ -23,9 +23,13 @@
 
 #include "bio/chemical/reaction/Reaction.h"
 
+#include <vector>
+
 namespace bio {
 namespace chemical {
 
+class Miscibility;
+
 /**
  * Mix is used by Solutes to combine within Solutions. However, you are welcome to mix un-Dissolved Substances as well. <br />
  */
@@ -63,6 +67,43 @@ public:
 	 * @return true iff there are 2 or more Reactants.
 	 */
 	virtual bool ReactantsMeetRequirements(const Reactants* toCheck) const;
+
+	/**
+	 * @return true; Mixing always needs at least 2 Reactants.
+	 */
+	virtual bool HasRequirements() const;
+
+	/**
+	 * The Miscibilities that apply when Mixing one Substance into another. <br />
+	 */
+	typedef ::std::vector< const Miscibility* > Miscibilities;
+
+	/**
+	 * Find the Miscibility of each Property shared by the given Substances. <br />
+	 * Substances of the same types always share the same Miscibilities, so these can be found once and used for many Superpose() calls (see Solution::Diffuse()). <br />
+	 * These are looked up in the GlobalMiscibilityMatrix, so only the first Mix between Substances with the same Properties does any real work. <br />
+	 * @param target
+	 * @param source
+	 * @param miscibilities what to fill; not cleared.
+	 */
+	static void GetMiscibilities(
+		const Substance* target,
+		const Substance* source,
+		Miscibilities& miscibilities
+	);
+
+	/**
+	 * Superpose source onto target according to the given Miscibilities. <br />
+	 * This is the work of Process() without the Reaction. <br />
+	 * @param target the Substance to modify.
+	 * @param source
+	 * @param miscibilities from GetMiscibilities().
+	 */
+	static void Superpose(
+		Substance* target,
+		const Substance* source,
+		const Miscibilities& miscibilities
+	);
 };
 
 } //chemical namespace
@@ -119,6 +119,15 @@ public:
 	{
 		//nop
 	}
+	/**
+	 * Clone() gives back a Wave, which cannot be reliably turned back into an ExcitationBase (Excitations derive from more than one Wave). <br />
+	 * Use this instead when you need your own, mutable copy of an Excitation (e.g. to EditArg() it). <br />
+	 * @return a new copy of *this.
+	 */
+	virtual ExcitationBase* CloneExcitation() const
+	{
+		return new ExcitationBase(*this);
+	}
 };
 
 #if BIO_CPP_VERSION >= 17
@@ -219,6 +228,14 @@ public:
 		ret->Set(this->operator()(ForceCast< WAVE* >(wave)));
 	}
 
+	/**
+	 * Override of ExcitationBase; see above. <br />
+	 */
+	virtual ExcitationBase* CloneExcitation() const
+	{
+		return new Excitation< WAVE, RETURN, ARGUMENTS... >(*this);
+	}
+
 protected:
 	RETURN (WAVE::*mFunction)(ARGUMENTS...);
 
@@ -298,6 +315,14 @@ public:
 		ret->Set(this->operator()(ForceCast< WAVE* >(wave))); 
 	}
 
+	/**
+	 * Override of ExcitationBase; see above. <br />
+	 */
+	virtual ExcitationBase* CloneExcitation() const
+	{
+		return new ExcitationWithoutArgument< WAVE, RETURN >(*this);
+	}
+
 protected:
 	RETURN (WAVE::*mFunction)();
 };
@@ -393,6 +418,14 @@ public:
 		ret->Set(this->operator()(ForceCast< WAVE* >(wave))); 
 	}
 
+	/**
+	 * Override of ExcitationBase; see above. <br />
+	 */
+	virtual ExcitationBase* CloneExcitation() const
+	{
+		return new ExcitationWithArgument< WAVE, RETURN, ARGUMENT >(*this);
+	}
+
 protected:
 	RETURN (WAVE::*mFunction)(ARGUMENT);
 
@@ -505,6 +538,14 @@ public:
 		ret->Set(this->operator()(ForceCast< WAVE* >(wave))); 
 	}
 
+	/**
+	 * Override of ExcitationBase; see above. <br />
+	 */
+	virtual ExcitationBase* CloneExcitation() const
+	{
+		return new ExcitationWithTwoArguments< WAVE, RETURN, ARGUMENT1, ARGUMENT2 >(*this);
+	}
+
 protected:
 	RETURN (WAVE::*mFunction)(
 		ARGUMENT1,
@@ -101,6 +101,12 @@ public:
 	 */
 	operator Reactants();
 
+	/**
+	 * Access the Substances of *this without copying them. <br />
+	 * @return the Substances in *this.
+	 */
+	const Substances& GetSubstances() const;
+
 protected:
 	Substances mSubstances;
 	Code mResult;
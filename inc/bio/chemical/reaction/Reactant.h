@@ -24,6 +24,8 @@
 #include "bio/chemical/common/Class.h"
 #include "bio/chemical/Substance.h"
 
+#include <vector>
+
 namespace bio {
 namespace chemical {
 
@@ -84,9 +86,103 @@ public:
 	 */
 	virtual bool operator==(const Substance& other) const;
 
+	/**
+	 * Check if the given Substance has every Property & State of *this and can be cast to the type of *this. <br />
+	 * The requirements of *this are compiled into bitmasks the first time this is called, so each check only costs 1 bit test per Property & State of the candidate, plus 1 Bond lookup. <br />
+	 * @param candidate
+	 * @return whether or not the candidate meets the requirements of *this.
+	 */
+	bool Matches(const Substance* candidate) const;
+
+	/**
+	 * Rebuild the compiled requirements of *this. <br />
+	 * Call this if you change the Properties or States of *this after it has been Matched. <br />
+	 */
+	void Compile() const;
+
 protected:
 	Name mTypeName;
 
+	//START: compiled requirements; see Matches().
+	mutable bool mCompiled;
+	mutable AtomicNumber mTypeId;
+	mutable ::std::vector< uint64_t > mPropertyMask;
+	mutable ::std::vector< uint64_t > mStateMask;
+	mutable ::std::size_t mNumProperties;
+	mutable ::std::size_t mNumStates;
+	//END: compiled requirements
+
+	/**
+	 * Set the bit for each T in the given Container. <br />
+	 * @tparam T
+	 * @param contents
+	 * @param mask
+	 * @return how many bits were newly set.
+	 */
+	template < typename T >
+	static ::std::size_t Mask(
+		const Container* contents,
+		::std::vector< uint64_t >& mask
+	)
+	{
+		::std::size_t ret = 0;
+		mask.clear();
+		if (!contents)
+		{
+			return ret;
+		}
+		for (
+			SmartIterator cnt = contents->Begin();
+			!cnt.IsAfterEnd();
+			++cnt
+			)
+		{
+			const ::std::size_t bit = cnt.template As< T >().mT;
+			if (mask.size() <= bit / 64)
+			{
+				mask.resize(bit / 64 + 1, 0);
+			}
+			if (!(mask[bit / 64] & (uint64_t(1) << (bit % 64))))
+			{
+				mask[bit / 64] |= uint64_t(1) << (bit % 64);
+				++ret;
+			}
+		}
+		return ret;
+	}
+
+	/**
+	 * @tparam T
+	 * @param contents
+	 * @param mask
+	 * @return how many Ts in contents are set in the mask.
+	 */
+	template < typename T >
+	static ::std::size_t CountMasked(
+		const Container* contents,
+		const ::std::vector< uint64_t >& mask
+	)
+	{
+		::std::size_t ret = 0;
+		if (!contents || mask.empty())
+		{
+			return ret;
+		}
+		for (
+			SmartIterator cnt = contents->Begin();
+			!cnt.IsAfterEnd();
+			++cnt
+			)
+		{
+			const ::std::size_t bit = cnt.template As< T >().mT;
+			if (bit / 64 < mask.size() && (mask[bit / 64] & (uint64_t(1) << (bit % 64))))
+			{
+				++ret;
+			}
+		}
+		return ret;
+	}
+
 };
 
 } //chemical namespace
@@ -67,6 +67,13 @@ public:
 	 * @return the Substances in *this.
 	 */
 	operator Substances();
+
+	/**
+	 * Replace the contents of *this with the given Substances, reusing *this rather than constructing new Reactants. <br />
+	 * This Clears *this and Adds each Substance, exactly as if *this were new; nothing is moved out of the given Substances. <br />
+	 * @param substances
+	 */
+	void Replace(const Substances& substances);
 };
 
 } //chemical namespace
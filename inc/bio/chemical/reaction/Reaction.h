@@ -201,6 +201,7 @@ public:
 
 	/**
 	 * Checks if the given Substances match the Reactants in *this. <br />
+	 * Each Required Reactant is checked with Reactant::Matches(). <br />
 	 * ORDER MATTERS! <br />
 	 * NOTE: toCheck may have MORE substances than just the reactants needed for this->Process but must have AT LEAST the required Reactants. <br />
 	 * @param toCheck
@@ -208,6 +209,13 @@ public:
 	 */
 	virtual bool ReactantsMeetRequirements(const Reactants* toCheck) const;
 
+	/**
+	 * Used to skip ReactantsMeetRequirements() when it would always be true (e.g. in a compiled molecular::Pathway). <br />
+	 * If you override ReactantsMeetRequirements(), override this too. <br />
+	 * @return whether or not ReactantsMeetRequirements() could ever reject some Reactants.
+	 */
+	virtual bool HasRequirements() const;
+
 	/**
 	 * A Reaction takes in some Reactants and checks if they match the Reactants for *this. <br />
 	 * If the inputs check out, the Reaction occurs and the products are returned. <br />
@@ -229,15 +237,22 @@ public:
 	 * Get a Reaction! <br />
 	 * This should be used to avoid unnecessary new and deletes. <br />
 	 * This only works for Reactions that have a name matching their type (i.e. were constructed with name=SafelyAccess<PeriodicTable>()->GetNameFromType(*this)), which is true for all Reactions in the core Biology framework. <br />
+	 * The Reaction is only looked up in the PeriodicTable the first time this is called for each T. <br />
 	 * @tparam T
 	 * @return a Reaction* of the given type or NULL, if no Reaction exists matching the TypeName of the given T.
 	 */
 	template < typename T >
 	static const T* Initiate()
 	{
-		const T* ret = Cast< const T* >(SafelyAccess< PeriodicTable >()->template GetTypeFromNameAs< T* >(type::TypeName< T >()));
-		BIO_SANITIZE_AT_SAFETY_LEVEL_1(ret,
-			return ret,
+		//Reactions registered in the PeriodicTable live as long as it does, so we only need to look each type up once.
+		static const T* sReaction = NULL;
+		if (sReaction)
+		{
+			return sReaction;
+		}
+		sReaction = Cast< const T* >(PeriodicTable::Instance().template GetTypeFromNameAs< T* >(type::TypeName< T >()));
+		BIO_SANITIZE_AT_SAFETY_LEVEL_1(sReaction,
+			return sReaction,
 			return NULL);
 	}
 
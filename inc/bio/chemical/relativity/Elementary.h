@@ -78,15 +78,32 @@ public:
 	 * Because the minimum requirements for LinearMotif's CONTENT_TYPE are only being a ChemicalClass<>, and anything else that deals with the PeriodicTable will likely be dealing with Substances or beyond, we've chosen to put this here. <br />
 	 * Ultimately, the cost of running if(!(!NULL)) on every class instantiation is worth the ease of use provided by automatic type registration. <br />
 	 * Records *this as the archetypal Wave for the id of T. <br />
-	 * @param force
+	 * If the PeriodicTable IsDeferringTypes(), the archetype will not be created until it is first used (see CreateType()). <br />
 	 */
 	void RegisterType()
 	{
 		static bool canRegister = true;
 		BIO_SANITIZE_AT_SAFETY_LEVEL_1(canRegister,,return)
 		canRegister = false;
+		{
+			SafelyAccess< PeriodicTable > periodicTable;
+			if (periodicTable->IsDeferringTypes())
+			{
+				periodicTable->template AssociateTypeCreator< T >(&Elementary< T >::CreateType);
+				return;
+			}
+		}
+		SafelyAccess< PeriodicTable >()->template AssociateType< T >(CreateType());
+	}
+
+	/**
+	 * Creates the archetypal Wave for T. <br />
+	 * @return a new T as a Wave.
+	 */
+	static physical::Wave* CreateType()
+	{
 		T* archetype = new T();
-		SafelyAccess< PeriodicTable >()->template AssociateType< T >(archetype->AsWave());
+		return archetype->AsWave();
 	}
 
 	/**
@@ -193,6 +193,11 @@ public:
 		);
 	}
 
+	/**
+	 * @return the number of times Properties have been Recorded in *this (i.e. changes whenever any type's Properties might have).
+	 */
+	uint32_t GetPropertiesGeneration() const;
+
 	/**
 	 * Associates the given Wave type with the given id. <br />
 	 * This is only necessary if you want to use GetTypeFromId later on. <br />
@@ -206,6 +211,20 @@ public:
 		return this->TypedPerspective< AtomicNumber >::AssociateType(GetIdFromType< T >(), type);
 	}
 
+	/**
+	 * Associates a function which creates the given Wave type with the given id. <br />
+	 * The type will be created the first time it is used (e.g. by GetInstance()). <br />
+	 * See TypedPerspective::DeferTypes() for more info. <br />
+	 * @tparam T
+	 * @param createType
+	 * @return true if the association completed successfully else false
+	 */
+	template < typename T >
+	bool AssociateTypeCreator(physical::Wave* (*createType)())
+	{
+		return this->TypedPerspective< AtomicNumber >::AssociateTypeCreator(GetIdFromType< T >(), createType);
+	}
+
 	/**
 	 * Removes the type association created by AssociateType(). <br />
 	 * @tparam T
@@ -246,6 +265,8 @@ protected:
 	{
 		return new Element(id, name);
 	}
+
+	uint32_t mPropertiesGeneration;
 };
 
 BIO_SINGLETON(PeriodicTable, PeriodicTableImplementation)
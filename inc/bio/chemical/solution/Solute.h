@@ -120,6 +120,7 @@ public:
 	/**
 	 * physical::Periodic method. <br />
 	 * Only does work if the DiffusionTime is Interval(). <br />
+	 * Does nothing if our Solution Diffuses its own Solutes (see Solution::DiffusesSolutes()). <br />
 	 * @return the result of diffusion
 	 */
 	virtual Code Crest();
@@ -66,7 +66,7 @@ public:
 	 */
 	BIO_DISAMBIGUATE_ALL_CLASS_METHODS(chemical, Solution)
 
-	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS(
+	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS_WITH_COMMON_CONSTRUCTOR(
 		chemical,
 		Solution,
 		filter::Chemical()
@@ -175,6 +175,28 @@ public:
 	 */
 	virtual const Solute operator[](const Name& substanceName) const;
 
+	/**
+	 * Diffuse every Solute in *this which has a diffusion::time::Interval() and whose own Interval has passed since it last Diffused. <br />
+	 * This does the same as CheckIn()ing each of those Solutes, but Passive() Diffusion is batched: <br />
+	 * each Solute is pushed to all of its children at once, finding the Miscibilities of its Substance only once, rather than running a Mix Reaction for every child. <br />
+	 * Call this (e.g. from your own Crest()) instead of Crest()ing each Solute, and SetDiffusesSolutes(true). <br />
+	 * cellular::Class does this every time it Crests, if it has been told to SetDiffusesSolutes(true). <br />
+	 * @return code::Success() or code::NoErrorNoSuccess(), if nothing was Diffused.
+	 */
+	virtual Code Diffuse();
+
+	/**
+	 * Say whether or not *this Diffuse()s its own Solutes periodically. <br />
+	 * If so, Solutes in *this do nothing when they Crest(), so that they are not Diffused twice. <br />
+	 * @param diffusesSolutes
+	 */
+	void SetDiffusesSolutes(bool diffusesSolutes);
+
+	/**
+	 * @return whether or not *this Diffuse()s its own Solutes periodically; false by default.
+	 */
+	bool DiffusesSolutes() const;
+
 	/**
 	 * @return the mSolutes from *this.
 	 */
@@ -182,6 +204,13 @@ public:
 
 protected:
 	physical::Line mSolutes;
+	bool mDiffusesSolutes;
+
+private:
+	/**
+	 *
+	 */
+	void CommonConstructor();
 };
 
 } //chemical namespace
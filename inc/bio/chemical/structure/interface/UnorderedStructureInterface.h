@@ -175,6 +175,23 @@ public:
 	}
 
 
+	/**
+	 * Gives the Revision of the T Motif in *this. <br />
+	 * The Revision changes whenever T are added to or removed from *this. <br />
+	 * @tparam T
+	 * @return the Revision of the T Motif; 0 if T is invalid.
+	 */
+	template < typename T >
+	Revision GetRevision() const
+	{
+		const UnorderedMotif< T >* implementer = this->As< UnorderedMotif< T >* >();
+		BIO_SANITIZE(implementer,
+			return implementer->GetRevisionImplementation(),
+			return 0
+		)
+	}
+
+
 	/**
 	 * USE WITH CAUTION!!! <br />
 	 * @tparam T
@@ -109,8 +109,36 @@ public:
 		log::GlobalLogger::Instance().Log(filter, level, this->GetStringFromImplementation().c_str());
 	}
 
+	/**
+	 * Implementation for getting the Revision of *this. <br />
+	 * The Revision changes every time Contents are added to or removed from *this. <br />
+	 * NOTE: changes made directly to the Container returned by GetAllImplementation() are not tracked. <br />
+	 * @return the current Revision of *this.
+	 */
+	virtual Revision GetRevisionImplementation()
+	{
+		return this->mRevision;
+	}
+
+	/**
+	 * const interface for getting the Revision of *this. <br />
+	 * @return the current Revision of *this.
+	 */
+	virtual Revision GetRevisionImplementation() const
+	{
+		return this->mRevision;
+	}
+
 protected:
+	/**
+	 * Give *this a new Revision. <br />
+	 * Call this whenever the Contents of *this change. <br />
+	 * Revisions are drawn from a single, global counter so that a new Motif never shares a Revision with one that was destroyed. <br />
+	 */
+	void Revise();
+
 	mutable Container* mContents;
+	Revision mRevision;
 };
 
 } //chemical namespace
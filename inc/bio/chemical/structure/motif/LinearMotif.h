@@ -30,6 +30,8 @@
 #include "bio/physical/shape/Line.h"
 #include "bio/common/type/RemovePointer.h"
 
+#include <vector>
+
 
 #if BIO_CPP_VERSION >= 11
 
@@ -168,10 +170,88 @@ public:
 		physical::Linear& added = Cast< physical::Line* >(this->mContents)->OptimizedAccess(addedPosition);
 		added.SetShared(false); //...but added contents are not shared.
 		CONTENT_TYPE ret = ChemicalCast< CONTENT_TYPE >(added.operator physical::Identifiable< Id >*());
+		this->Revise();
 		BIO_SANITIZE(ret == content, , return NULL)
 		return ret;
 	}
 
+	/**
+	 * Adds content to *this WITHOUT taking ownership of it. <br />
+	 * Shared contents (physical::Linear::IsShared()) are not deleted with *this, so the same content may be held by many Motifs at once. <br />
+	 * Shared contents should be treated as immutable; use UnshareImplementation() to get a copy which may be changed. <br />
+	 * @param content
+	 * @return content or NULL.
+	 */
+	virtual CONTENT_TYPE ShareImplementation(CONTENT_TYPE content)
+	{
+		BIO_SANITIZE(content, , return NULL)
+		physical::Linear toAdd = physical::Linear(Cast< physical::Identifiable< Id >* >(content));
+		Index addedPosition = this->mContents->Add(toAdd); //stored as shared, which is what we want.
+		BIO_SANITIZE(addedPosition, , return NULL)
+		this->Revise();
+		return content;
+	}
+
+	/**
+	 * @param id
+	 * @return whether or not the Content of the given id is Shared, i.e. not owned by *this.
+	 */
+	virtual bool IsSharedImplementation(const Id& id) const
+	{
+		Index found = Cast< physical::Line* >(this->mContents)->SeekToId(id);
+		if (!found)
+		{
+			return false;
+		}
+		return Cast< physical::Line* >(this->mContents)->OptimizedAccess(found).IsShared();
+	}
+
+	/**
+	 * Copy on write for Shared contents. <br />
+	 * If the Content of the given id is Shared, it is replaced (at the same position) by a Clone owned by *this. <br />
+	 * Contents already owned by *this are returned as is. <br />
+	 * @param id
+	 * @return a Content of the given id which may be changed or NULL.
+	 */
+	virtual CONTENT_TYPE UnshareImplementation(const Id& id)
+	{
+		physical::Line* contents = Cast< physical::Line* >(this->mContents);
+		Index found = contents->SeekToId(id);
+		if (!found)
+		{
+			return NULL;
+		}
+		CONTENT_TYPE original = ChemicalCast< CONTENT_TYPE >(contents->LinearAccess(found));
+		if (!contents->OptimizedAccess(found).IsShared())
+		{
+			return original;
+		}
+
+		CONTENT_TYPE copy = CloneAndCast< CONTENT_TYPE >(original);
+		BIO_SANITIZE(copy, , return NULL)
+		contents->Erase(found); //Shared, so original is not deleted.
+		contents->Insert(
+			physical::Linear(Cast< physical::Identifiable< Id >* >(copy)),
+			found
+		);
+		contents->OptimizedAccess(found).SetShared(false);
+		this->Revise();
+		return copy;
+	}
+
+	/**
+	 * Name based version of UnshareImplementation(Id). <br />
+	 * @param name
+	 * @return a Content of the given name which may be changed or NULL.
+	 */
+	virtual CONTENT_TYPE UnshareByNameImplementation(const Name& name)
+	{
+		physical::Line* contents = Cast< physical::Line* >(this->mContents);
+		Index found = contents->SeekToName(name);
+		BIO_SANITIZE_AT_SAFETY_LEVEL_1(found, , return NULL)
+		return UnshareImplementation(contents->LinearAccess(found)->GetId());
+	}
+
 	/**
 	 * Adds a Content in *this at the indicated position. <br />
 	 * Multiple contents of the same id will cause the previously existing Content to be removed. <br />
@@ -254,6 +334,7 @@ public:
 				}
 			}
 			this->mContents->Erase(toReplace);
+			this->Revise();
 		}
 
 		switch (position)
@@ -311,6 +392,7 @@ public:
 			}
 		} //switch
 
+		this->Revise();
 		return ret;
 	}
 
@@ -383,7 +465,7 @@ public:
 	 */
 	virtual CONTENT_TYPE CreateImplementation()
 	{
-		CONTENT_TYPE created = SafelyAccess< PeriodicTable >()->template GetInstance< typename type::RemovePointer< CONTENT_TYPE >::Type >();
+		CONTENT_TYPE created = PeriodicTable::Instance().template GetInstance< typename type::RemovePointer< CONTENT_TYPE >::Type >();
 		BIO_SANITIZE(created, , return NULL)
 		return created;
 	}
@@ -457,6 +539,7 @@ public:
 		physical::Identifiable< Id >* got = Cast< physical::Line* >(this->mContents)->LinearAccess(found);
 		CONTENT_TYPE ret = ChemicalCast< CONTENT_TYPE >(got);
 		this->mContents->Erase(found); //Erases the pointer but the pointed-to object should still exist.
+		this->Revise();
 		return ret;
 	}
 
@@ -474,6 +557,7 @@ public:
 		physical::Identifiable< Id >* got = Cast< physical::Line* >(this->mContents)->LinearAccess(found);
 		CONTENT_TYPE ret = ChemicalCast< CONTENT_TYPE >(got);
 		this->mContents->Erase(found); //Erases the pointer but the pointed-to object should still exist.
+		this->Revise();
 		return ret;
 	}
 
@@ -498,6 +582,38 @@ public:
 		BIO_SANITIZE(other, , return);
 
 		this->mContents->Import(other->mContents);
+		this->Revise();
+	}
+
+	/**
+	 * Override of Atom method. See that class for details. <br />
+	 * @return the physical::Line holding the Contents of *this.
+	 */
+	virtual physical::Line* GetLinearContents()
+	{
+		return Cast< physical::Line* >(this->mContents);
+	}
+
+	/**
+	 * Override of Atom method. See that class for details. <br />
+	 * @return the physical::Line holding the Contents of *this.
+	 */
+	virtual const physical::Line* GetLinearContents() const
+	{
+		return Cast< const physical::Line* >(this->mContents);
+	}
+
+	/**
+	 * Override of Atom method. See that class for details. <br />
+	 * @param content
+	 * @return content, as it is now held by *this, or NULL, if it is not a CONTENT_TYPE.
+	 */
+	virtual physical::Identifiable< Id >* AddLinearContent(physical::Wave* content)
+	{
+		BIO_SANITIZE(content && content->AsAtom(), , return NULL)
+		CONTENT_TYPE toAdd = ChemicalCast< CONTENT_TYPE >(content);
+		BIO_SANITIZE(toAdd, , return NULL)
+		return Cast< physical::Identifiable< Id >* >(AddImplementation(toAdd));
 	}
 
 	/**
@@ -517,7 +633,7 @@ public:
 			)
 		{
 			CONTENT_TYPE content = cnt.template As< CONTENT_TYPE >();
-			if (affinity->AttractionExists(content->AsWave()))
+			if (content && affinity->AttractionExists(content->AsWave()))
 			{
 				ret.Add(content);
 			}
@@ -637,6 +753,7 @@ public:
 	{
 		//No need to delete anything, since our Linear wrapper handles that for us.
 		this->mContents->Clear();
+		this->Revise();
 	}
 };
 } //chemical namespace
@@ -94,6 +94,7 @@ public:
 	virtual void ClearImplementation()
 	{
 		this->mContents->Clear();
+		this->Revise();
 	}
 
 	/**
@@ -113,6 +114,7 @@ public:
 	virtual CONTENT_TYPE AddImplementation(const CONTENT_TYPE content)
 	{
 		CONTENT_TYPE ret = this->mContents->Access(this->mContents->Add(content));
+		this->Revise();
 		return ret;
 	}
 
@@ -125,6 +127,7 @@ public:
 		Index toErase = this->mContents->SeekTo(content);
 		CONTENT_TYPE ret = this->mContents->Access(toErase);
 		this->mContents->Erase(toErase);
+		this->Revise();
 		return ret;
 	}
 
@@ -147,6 +150,7 @@ public:
 		BIO_SANITIZE(other, , return);
 
 		this->mContents->Import(other->GetAllImplementation());
+		this->Revise();
 	}
 
 	/**
@@ -0,0 +1,221 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2023 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Snapshot.h"
+#include "bio/physical/symmetry/Journal.h"
+#include "bio/common/thread/ThreadSafe.h"
+
+#include <string>
+#include <vector>
+
+//@formatter:off
+#if BIO_CPP_VERSION >= 11
+	#include <unordered_map>
+#else
+	#include <map>
+#endif
+//@formatter:on
+
+namespace bio {
+namespace chemical {
+
+/**
+ * A Checkpoint keeps an object saved by writing a full Snapshot once and then appending only what has changed. <br />
+ * <br />
+ * The first Take() (and every Take() after compactEvery deltas) Compacts: a full Snapshot is written to the given path. <br />
+ * Compacting makes *this the Journal of every Symmetry it Records, so each Symmetry tells *this when it is written to (see Symmetry::AccessValue()). <br />
+ * Every other Take() Records only the Symmetries which were written to since the last Take(); nothing else is walked or Spun. <br />
+ * These deltas are appended to a log beside the full Snapshot (path + ".delta"). <br />
+ * In a delta, each record's Id is the position of the changed Wave in the full Snapshot. <br />
+ * <br />
+ * This means changes are only seen if they go through a Symmetry. If a Wave keeps its state elsewhere, Spin() it after changing it. <br />
+ * If a Recorded Symmetry is destroyed (e.g. a Motif lost Contents), positions are no longer valid, so the next Take() Compacts instead. <br />
+ * Waves added to the object are not Journaled until the next Compaction, so call Compact() after adding them. <br />
+ * Every full Snapshot has a generation. Deltas from another generation (e.g. left over from a crash during Compaction) are ignored when Recovering. <br />
+ */
+class Checkpoint :
+	public Snapshot,
+	public physical::Journal,
+	virtual public ThreadSafe
+{
+public:
+
+	/**
+	 * @param path where to write the full Snapshot; deltas go to path + ".delta".
+	 * @param compactEvery how many deltas to append before writing a new full Snapshot.
+	 */
+	Checkpoint(
+		const char* path,
+		Index compactEvery = 16
+	);
+
+	/**
+	 * Stops Journaling the Symmetries *this Recorded. <br />
+	 */
+	virtual ~Checkpoint();
+
+	/**
+	 * Append the changes to the given object since the last Take() to the delta log. <br />
+	 * Compacts instead, if needed (see above). <br />
+	 * @param root
+	 * @return code::Success() or whatever went wrong.
+	 */
+	Code Take(const physical::Wave* root);
+
+	/**
+	 * Write a full Snapshot of the given object and empty the delta log. <br />
+	 * @param root
+	 * @return code::Success() or whatever went wrong.
+	 */
+	Code Compact(const physical::Wave* root);
+
+	/**
+	 * Restore the given object from the full Snapshot, then apply each delta from the same generation, in order. <br />
+	 * Later Take()s will continue the same delta log. <br />
+	 * @param root
+	 * @return code::Success() or whatever went wrong.
+	 */
+	Code Recover(physical::Wave* root);
+
+	/**
+	 * @return the number of deltas appended since the last Compaction.
+	 */
+	Index GetNumberOfDeltas() const;
+
+	/**
+	 * Journal method. See that class for details. <br />
+	 * Marks the position of the given Symmetry as dirty. <br />
+	 * @param changed
+	 */
+	virtual void Note(physical::Symmetry* changed);
+
+	/**
+	 * Journal method. See that class for details. <br />
+	 * Positions are no longer valid, so the next Take() will Compact. <br />
+	 * @param gone
+	 */
+	virtual void Forget(physical::Symmetry* gone);
+
+protected:
+
+	/**
+	 * What RecordWave() should do. <br />
+	 */
+	enum Mode
+	{
+		FULL,
+		COLLECT
+	};
+
+	/**
+	 * Override of Snapshot method. See that class for details. <br />
+	 * Perspectives are only Recorded in full Snapshots. <br />
+	 */
+	virtual void RecordPerspectives();
+
+	/**
+	 * Override of Snapshot method. See that class for details. <br />
+	 * Depending on mMode, Records everything or nothing (collecting the Waves for Recover()). <br />
+	 * In both Modes, the Symmetry of the given Wave is Journaled at its position. <br />
+	 * @param wave
+	 * @param parent
+	 * @param identity
+	 * @param link
+	 * @return the position of the given Wave.
+	 */
+	virtual Index RecordWave(
+		const physical::Wave* wave,
+		Index parent,
+		const physical::Identifiable< Id >* identity,
+		const Link& link
+	);
+
+	/**
+	 * Walk the given object, Recording as per the given Mode. <br />
+	 * Anything Journaled before is forgotten first. <br />
+	 * @param root
+	 * @param mode
+	 */
+	void Walk(
+		const physical::Wave* root,
+		Mode mode
+	);
+
+	/**
+	 * Records the current mGeneration in *this. <br />
+	 */
+	void RecordGeneration();
+
+	/**
+	 * @return the generation Recorded in *this or 0.
+	 */
+	uint64_t GetRecordedGeneration() const;
+
+	/**
+	 * Start Journaling the Symmetry of the given Wave at the given position. <br />
+	 * @param wave
+	 * @param position
+	 */
+	void Track(
+		const physical::Wave* wave,
+		Index position
+	);
+
+	/**
+	 * Stop Journaling everything and forget what was dirty. <br />
+	 */
+	void Untrack();
+
+	/**
+	 * Forget what was dirty (e.g. after Recording or Reifying everything). <br />
+	 */
+	void ClearDirty();
+
+#if BIO_CPP_VERSION >= 11
+	typedef ::std::unordered_map< const physical::Symmetry*, Index > Positions;
+#else
+	typedef ::std::map< const physical::Symmetry*, Index > Positions;
+#endif
+
+	::std::string mPath;
+	::std::string mLogPath;
+	Index mCompactEvery;
+	Index mNumDeltas;
+	bool mHasBase;
+	uint64_t mGeneration;
+
+	Mode mMode;
+	Index mPosition;
+	physical::Snapshot mDelta;
+	::std::vector< const physical::Wave* > mCollected;
+
+	//Guarded by ThreadSafe, since Symmetries may be written to from any thread.
+	Positions mPositions;
+	::std::vector< physical::Symmetry* > mTracked; //by position; NULL if gone.
+	::std::vector< bool > mIsDirty; //by position.
+	::std::vector< Index > mDirty;
+	bool mStructureChanged;
+};
+
+} //chemical namespace
+} //bio namespace
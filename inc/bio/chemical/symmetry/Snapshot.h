@@ -0,0 +1,237 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2023 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "bio/physical/symmetry/Snapshot.h"
+#include "bio/physical/relativity/Identifiable.h"
+#include "bio/chemical/common/Types.h"
+
+#include <set>
+#include <vector>
+
+namespace bio {
+namespace chemical {
+
+/**
+ * chemical::Snapshots Capture whole objects (e.g. a Habitat and all of its Organisms) by walking their Bonds and the Contents of their LinearMotifs. <br />
+ * Each Wave found is Spun and Recorded, along with the Id and Name of each Motif Content and how it was held (see Holding): by which Bond or in which Motif. <br />
+ * The PeriodicTable Id of each Wave is Recorded too, as are the common Perspectives (Ids, the PeriodicTable, Properties, States, etc.). <br />
+ * <br />
+ * There are 2 ways to Restore a Snapshot: <br />
+ * 1. Restore(root) walks the given object in the same way, checking that it has the same shape as what was Captured, then Reifies each Wave and renames each Content. This requires something with the same structure (e.g. a Clone() of what was Captured). <br />
+ * 2. Restore() creates the object from nothing: each Wave is created from the PeriodicTable by its Recorded Id, then Bonded or added to the Motif it was Captured in (unless its parent already holds it, e.g. because the parent's constructor Formed that Bond), then Reified. <br />
+ * Nothing is Grown, Differentiated, etc. when Restoring. <br />
+ * <br />
+ * To Record and Restore your own Perspectives, override RecordPerspectives() and RestorePerspectives(), then call the parent methods. <br />
+ * <br />
+ * A Snapshot of only the Perspectives can also be used to start a process quickly: <br />
+ * Once, (e.g. when building or deploying) run your program until it has used all the Names it needs, then CapturePerspectives() and Write() them. <br />
+ * Then, at the start of every other run, Preload() what was Written. This creates every Id at once, rather than one at a time as each is first used, and defers the creation of each type in the PeriodicTable until it is first needed. <br />
+ */
+class Snapshot :
+	public physical::Snapshot
+{
+public:
+
+	/**
+	 *
+	 */
+	Snapshot();
+
+	/**
+	 *
+	 */
+	virtual ~Snapshot();
+
+	/**
+	 * Replace the contents of *this with the given object and everything it holds. <br />
+	 * @param root
+	 * @return code::Success() or code::BadArgument1(), if root is NULL.
+	 */
+	Code Capture(const physical::Wave* root);
+
+	/**
+	 * How each Wave was held by the Wave Recorded as its parent. <br />
+	 * Stored as the mKind of each physical::Snapshot::Link. <br />
+	 */
+	enum Holding
+	{
+		ROOT,
+		BONDED, //the Link holds the AtomicNumber & BondType of the Bond.
+		CONTENT //the Wave was in the Contents of its parent (a LinearMotif).
+	};
+
+	/**
+	 * Restore the Perspectives in *this, then the given object and everything it holds. <br />
+	 * @param root
+	 * @return code::Success(); code::BadArgument1(), if root does not have the same structure as what was Captured; or code::CouldNotFindValue1(), if *this is empty.
+	 */
+	Code Restore(physical::Wave* root) const;
+
+	/**
+	 * Restore the Perspectives in *this, then create the Captured object and everything it held. <br />
+	 * Every type must be Associated with the PeriodicTable (true for any chemical::Class that has been used in this process). <br />
+	 * Anything which cannot be created is skipped, along with everything it held. <br />
+	 * @return a new object, which you own, or NULL, if *this is empty or its root could not be created.
+	 */
+	physical::Wave* Restore() const;
+
+	/**
+	 * Replace the contents of *this with only the Perspectives (see RecordPerspectives()). <br />
+	 */
+	void CapturePerspectives();
+
+	/**
+	 * Read the Perspectives Captured and Written by another process and Restore them all at once. <br />
+	 * This should be called at the start of your program, before any Ids are used. <br />
+	 * @param path
+	 * @param deferTypes whether or not the PeriodicTable should wait to create each type until it is first used (see TypedPerspective::DeferTypes()).
+	 * @return code::Success() or whatever went wrong.
+	 */
+	Code Preload(
+		const char* path,
+		bool deferTypes = true
+	);
+
+protected:
+
+	/**
+	 * Called by Capture() before any Waves are Recorded. <br />
+	 */
+	virtual void RecordPerspectives();
+
+	/**
+	 * What each Recorded Id is now, in this process. <br />
+	 * The Ids in the PeriodicTable, BondTypePerspective, etc. may be given out in a different order than in the process that Captured *this, so every Recorded Id is looked up by its Recorded Name. <br />
+	 * Each vector is indexed by the Recorded Id; Ids which could not be found are InvalidId(). <br />
+	 */
+	struct Remap
+	{
+		::std::vector< Id > mIds;
+		::std::vector< AtomicNumber > mAtomicNumbers;
+		::std::vector< BondType > mBondTypes;
+	};
+
+	/**
+	 * Called by Restore() before any Waves are Restored. <br />
+	 * @param remap filled with the current Id of each Recorded Id.
+	 * @return code::Success() or the first thing that went wrong.
+	 */
+	virtual Code RestorePerspectives(Remap& remap) const;
+
+	/**
+	 * @tparam DIMENSION
+	 * @param remap from Remap.
+	 * @param recorded an Id as it was Recorded.
+	 * @return the current Id for the given Recorded Id or InvalidId() (0), if it has no Name here.
+	 */
+	template < typename DIMENSION >
+	static DIMENSION Remapped(
+		const ::std::vector< DIMENSION >& remap,
+		uint32_t recorded
+	)
+	{
+		if (recorded >= remap.size())
+		{
+			return DIMENSION(0);
+		}
+		return remap[recorded];
+	}
+
+	typedef ::std::set< const void* > Visited;
+
+	/**
+	 * Waves may be reached through many Bonds (and through many Wave bases of the same object), so we use their Atom, when they have one, to tell if we've seen them before. <br />
+	 * @param wave
+	 * @return what to store in Visited for the given Wave.
+	 */
+	static const void* GetVisitKey(const physical::Wave* wave);
+
+	/**
+	 * Called by CaptureWave() for each Wave, in order. <br />
+	 * Override this to change what is Recorded (e.g. only what has changed; see Checkpoint). <br />
+	 * @param wave
+	 * @param parent what was returned for the parent of the given Wave or NoParent().
+	 * @param identity the Wave as an Identifiable, if it was a Motif Content; else NULL.
+	 * @param link how the given Wave is held by its parent (see Holding).
+	 * @return the index to give as the parent of whatever the given Wave holds.
+	 */
+	virtual Index RecordWave(
+		const physical::Wave* wave,
+		Index parent,
+		const physical::Identifiable< Id >* identity,
+		const Link& link
+	);
+
+	/**
+	 * Record the given Wave and everything it holds. <br />
+	 * @param wave
+	 * @param parent
+	 * @param identity the Wave as an Identifiable, if it was a Motif Content; else NULL.
+	 * @param link how the given Wave is held by its parent (see Holding).
+	 * @param visited
+	 */
+	void CaptureWave(
+		const physical::Wave* wave,
+		Index parent,
+		const physical::Identifiable< Id >* identity,
+		const Link& link,
+		Visited& visited
+	);
+
+	/**
+	 * Reify the given Wave from the given record and, if it is a Content, give it its Recorded Id. <br />
+	 * @param wave
+	 * @param identity the Wave as an Identifiable, if it is a Motif Content; else NULL.
+	 * @param record
+	 * @param remap from RestorePerspectives().
+	 */
+	void RestoreRecord(
+		physical::Wave* wave,
+		physical::Identifiable< Id >* identity,
+		Index record,
+		const Remap& remap
+	) const;
+
+	/**
+	 * Restore the given Wave and everything it holds. <br />
+	 * Must walk the given Wave in the same order as CaptureWave(). <br />
+	 * @param wave
+	 * @param parent
+	 * @param identity the Wave as an Identifiable, if it is a Motif Content; else NULL.
+	 * @param next the next record to Restore.
+	 * @param visited
+	 * @param remap from RestorePerspectives().
+	 * @return code::Success() or code::BadArgument1(), if the given Wave does not match what was Captured.
+	 */
+	Code RestoreWave(
+		physical::Wave* wave,
+		Index parent,
+		physical::Identifiable< Id >* identity,
+		Index& next,
+		Visited& visited,
+		const Remap& remap
+	) const;
+};
+
+} //chemical namespace
+} //bio namespace
@@ -194,6 +194,20 @@ public:
 	 */
 	void Set(const ByteStream& other);
 
+	/**
+	 * Copies size bytes from the given address into *this and Holds them as if they were Set with a type named typeName. <br />
+	 * This is used when the type is not known at compile time (e.g. when reading bytes back from a file). <br />
+	 * Type names are kept for the life of the program, like those from type::TypeName<>(). <br />
+	 * @param bytes
+	 * @param size
+	 * @param typeName
+	 */
+	void Set(
+		const void* bytes,
+		::std::size_t size,
+		const String& typeName
+	);
+
 	/**
 	 * Frees the memory *this was Holding. <br />
 	 * Nop if *this was not holding anything. <br />
@@ -21,16 +21,185 @@
 
 #pragma once
 
+#include "bio/common/macro/LanguageMacros.h"
+
+#include <cstddef>
+
+//@formatter:off
+#if BIO_CPP_VERSION < 11
+	#include <stdint.h>
+#else
+	#include <cstdint>
+#endif
+//@formatter:on
+
 /**
  * the random namespace provides functions for generating random numbers. <br />
- * IMPORTANT: random is currently only implemented in c++11. <br />
- * When not using c++ >= 11, 0 is returned. <br />
+ * <br />
+ * All random numbers come from Streams. A Stream is counter-based: the nth number of a Stream depends only on the Stream's key and n, so Streams need no shared state and the same Stream always gives the same numbers, on every platform and language version. <br />
+ * The key of a Stream is made from a seed and a stream id. By default, the seed is the global seed (see SetSeed()). The stream id should be something stable, such as the Id of the object using the Stream. <br />
+ * <br />
+ * The free functions below (e.g. NormalFloat()) use a Stream that belongs to the calling thread (see GetThreadStream()), so they are safe to call from many threads at once. <br />
+ * If you need results that do not depend on how work is divided between threads, give each object its own Stream instead. <br />
  */
 
 namespace bio {
 namespace random {
+
+/**
+ * The SplitMix64 finalizer. <br />
+ * @param value
+ * @return value, thoroughly mixed.
+ */
+uint64_t Mix(uint64_t value);
+
+/**
+ * Set the seed used by all Streams created without one. <br />
+ * Thread Streams created with a different seed will be reset the next time they are used. <br />
+ * The default seed is 0. <br />
+ * @param seed
+ */
+void SetSeed(uint64_t seed);
+
+/**
+ * @return the seed used by all Streams created without one.
+ */
+uint64_t GetSeed();
+
+/**
+ * A Stream is a counter-based generator of random numbers. <br />
+ * The nth number is Mix(key + n * gamma), which is exactly the nth output of SplitMix64 started from key, so a Stream can Skip() ahead or be divided among workers for free. <br />
+ * Because each number is independent of the last, the Fill methods generate numbers in blocks which the compiler can vectorize. <br />
+ */
+class Stream
+{
+public:
+
+	/**
+	 * Start a Stream from the global seed. <br />
+	 * @param streamId something stable (e.g. an object's Id) to distinguish this Stream from others.
+	 */
+	Stream(uint64_t streamId = 0);
+
+	/**
+	 * @param seed
+	 * @param streamId something stable (e.g. an object's Id) to distinguish this Stream from others.
+	 */
+	Stream(
+		uint64_t seed,
+		uint64_t streamId
+	);
+
+	/**
+	 *
+	 */
+	virtual ~Stream();
+
+	/**
+	 * Start *this over from the given seed and stream id. <br />
+	 * @param seed
+	 * @param streamId
+	 */
+	void Reset(
+		uint64_t seed,
+		uint64_t streamId
+	);
+
+	/**
+	 * @return the next 64 random bits.
+	 */
+	uint64_t Next();
+
+	/**
+	 * Advance *this as if Next() had been called count times. <br />
+	 * @param count
+	 */
+	void Skip(uint64_t count);
+
+	/**
+	 * @return the number of values *this has given.
+	 */
+	uint64_t GetPosition() const;
+
+	/**
+	 * @return the seed *this was created with.
+	 */
+	uint64_t GetSeed() const;
+
+	/**
+	 * @return a double uniformly distributed in (0, 1].
+	 */
+	double Uniform();
+
+	/**
+	 * x ~ Uniform <br />
+	 * @param min
+	 * @param max
+	 * @return a value between min and max, uniformly distributed.
+	 */
+	float UniformFloat(
+		float min,
+		float max
+	);
+
+	/**
+	 * x ~ Normal as float <br />
+	 * Normals are made in pairs; the second of each pair is kept for the next call. <br />
+	 * @param mean
+	 * @param standardDeviation
+	 * @return a number normally distributed around mean with standardDeviation.
+	 */
+	float NormalFloat(
+		float mean,
+		float standardDeviation
+	);
+
+	/**
+	 * Fill the given array with values uniformly distributed between min and max. <br />
+	 * @param out
+	 * @param count
+	 * @param min
+	 * @param max
+	 */
+	void FillUniform(
+		float* out,
+		::std::size_t count,
+		float min,
+		float max
+	);
+
+	/**
+	 * Fill the given array with values normally distributed around mean with standardDeviation. <br />
+	 * @param out
+	 * @param count
+	 * @param mean
+	 * @param standardDeviation
+	 */
+	void FillNormal(
+		float* out,
+		::std::size_t count,
+		float mean,
+		float standardDeviation
+	);
+
+protected:
+	uint64_t mSeed;
+	uint64_t mKey;
+	uint64_t mPosition;
+	float mSpareNormal; //standard normal
+	bool mHasSpareNormal;
+};
+
+/**
+ * Each thread has its own Stream. <br />
+ * Thread Streams are numbered in the order threads first ask for them, starting with 0, and are keyed by the global seed and that number. <br />
+ * @return the Stream of the calling thread.
+ */
+Stream& GetThreadStream();
+
 /**
  * x ~ Normal as float <br />
+ * Uses the Stream of the calling thread. <br />
  * @param mean
  * @param standardDeviation
  * @return a number normally distributed around mean with standardDeviation.
@@ -42,6 +211,7 @@ float NormalFloat(
 
 /**
  * x ~ Uniform <br />
+ * Uses the Stream of the calling thread. <br />
  * @param min
  * @param max
  * @return a value between min and max, uniformly distributed.
@@ -51,5 +221,27 @@ float UniformFloat(
 	float max
 );
 
+/**
+ * Fill the given array using the Stream of the calling thread. <br />
+ * See Stream::FillNormal(). <br />
+ */
+void FillNormal(
+	float* out,
+	::std::size_t count,
+	float mean,
+	float standardDeviation
+);
+
+/**
+ * Fill the given array using the Stream of the calling thread. <br />
+ * See Stream::FillUniform(). <br />
+ */
+void FillUniform(
+	float* out,
+	::std::size_t count,
+	float min,
+	float max
+);
+
 } //random namespace
 } //bio namespace
@@ -0,0 +1,134 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2023 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "bio/common/Types.h"
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+namespace bio {
+
+/**
+ * A TimerWheel tells you which timers have expired without looking at the ones that haven't. <br />
+ * Timers are kept in 4 levels of 256 slots each (1ms, 256ms, ~65s, & ~4.7h per slot), plus an overflow for anything further out than that. <br />
+ * Timers are moved down a level as their time draws near and are expired from the lowest level, so Advance()ing costs time proportional to the number of timers that expire (and the number of occupied slots passed), rather than the number of timers scheduled. <br />
+ * <br />
+ * Timers are just a time & an item (e.g. an index into some other array). <br />
+ * Timers cannot be cancelled; instead, callers should remember the time they expect each item to expire and ignore any expired timers that don't match. <br />
+ * <br />
+ * TimerWheels are not ThreadSafe. <br />
+ */
+class TimerWheel
+{
+public:
+
+	/**
+	 * When & which item. <br />
+	 */
+	typedef ::std::pair< Timestamp, ::std::size_t > Timer;
+	typedef ::std::vector< Timer > Timers;
+
+	/**
+	 * @param now the time to start from.
+	 */
+	explicit TimerWheel(Timestamp now = 0);
+
+	/**
+	 *
+	 */
+	~TimerWheel();
+
+	/**
+	 * Expire the given item at the given time. <br />
+	 * Items scheduled for GetTime() or earlier will be expired by the next call to Advance(). <br />
+	 * @param item
+	 * @param when
+	 */
+	void Schedule(
+		::std::size_t item,
+		Timestamp when
+	);
+
+	/**
+	 * Move *this forward to the given time, collecting every timer that expires on the way. <br />
+	 * Does not move *this backward. <br />
+	 * @param now
+	 * @param expired will have all expired Timers appended to it.
+	 */
+	void Advance(
+		Timestamp now,
+		Timers& expired
+	);
+
+	/**
+	 * Drop all Timers without changing the time. <br />
+	 */
+	void Clear();
+
+	/**
+	 * @return the time *this has Advance()d to.
+	 */
+	Timestamp GetTime() const;
+
+	/**
+	 * @return how many Timers have yet to expire.
+	 */
+	::std::size_t GetNumberOfTimers() const;
+
+protected:
+
+	/**
+	 * Put the given Timer in the level that matches how far away it is. <br />
+	 * @param timer
+	 */
+	void Place(const Timer& timer);
+
+	/**
+	 * Move *this forward by 1ms. <br />
+	 */
+	void Step();
+
+	/**
+	 * @param level
+	 * @param slot
+	 * @return the Timers at the given slot of the given level.
+	 */
+	Timers& GetSlot(
+		unsigned int level,
+		::std::size_t slot
+	);
+
+	static const unsigned int sBits = 8;
+	static const ::std::size_t sSlots = 256; //i.e. 1 << sBits
+	static const unsigned int sLevels = 4;
+
+	Timestamp mNow;
+	::std::vector< Timers > mSlots;
+	::std::size_t mLevelCounts[sLevels];
+	Timers mOverflow;
+	Timers mDue;
+	::std::size_t mCount;
+};
+
+} //bio namespace
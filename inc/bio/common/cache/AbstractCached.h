@@ -21,11 +21,21 @@
 
 #pragma once
 
+#include "bio/common/macro/LanguageMacros.h"
+
+//@formatter:off
+#if BIO_CPP_VERSION < 11
+	#include <stdint.h>
+#else
+	#include <cstdint>
+#endif
+//@formatter:on
+
 namespace bio {
 
 /**
  * AbstractCached is a base class for all Cached objects.  <br />
- * NOTE: *this will Register on construction and Deregister on destruction. Because these functions are called in ?tors, they cannot be virtual. This may change in a future release.
+ * Cached objects are not registered anywhere. Instead, each remembers the generation of the GlobalCache it was looked up in and, when used after the GlobalCache has been Flushed, looks itself up again (see IsStale()). <br />
  */
 class AbstractCached
 {
@@ -48,16 +58,20 @@ public:
 		//nop
 	}
 
+protected:
+
 	/**
-	 * Register *this with the global Cache
+	 * @return whether or not the GlobalCache has been Flushed since *this was last Refreshed.
 	 */
-	void Register();
+	bool IsStale() const;
 
 	/**
-	 * Remove *this from the global Cache's register.
+	 * Record that *this has been looked up in the current generation of the GlobalCache. <br />
+	 * Call this from Flush(). <br />
 	 */
-	void Deregister();
-};
+	void Refresh();
 
+	uint32_t mGeneration;
+};
 
 } //bio namespace
@@ -21,15 +21,21 @@
 
 #pragma once
 
-#include "bio/common/container/Arrangement.h"
 #include "bio/common/macro/Macros.h"
+#include "bio/common/thread/ThreadSafe.h"
 
-namespace bio {
+//@formatter:off
+#if BIO_CPP_VERSION < 11
+	#include <stdint.h>
+#else
+	#include <cstdint>
+#endif
+//@formatter:on
 
-class AbstractCached;
+namespace bio {
 
 /**
- * A Cache is a register of Cached objects. <br />
+ * A Cache tracks when Cached objects must be looked up again. <br />
  * This class provides an easy to use interface for accessing cached variables. <br />
  * <br />
  * When to use: <br />
@@ -40,8 +46,7 @@ class AbstractCached;
  * The Biology library make heavy use of Name <-> Id pairings. Ids are faster; names are more robust. <br />
  * Any kind of speed trade off through pairing is a candidate for caching. <br />
  */
-class Cache :
-	public Arrangement< AbstractCached* >
+class Cache
 {
 public:
 
@@ -57,8 +62,17 @@ public:
 
 	/**
 	 * Flushes all Cached objects, causing them to be looked up again. <br />
+	 * Nothing is looked up here; instead, the generation of *this is advanced and each Cached object looks itself up again the next time it is used. <br />
 	 */
 	virtual void Flush();
+
+	/**
+	 * @return the number of times *this has been Flushed.
+	 */
+	uint32_t GetGeneration() const;
+
+protected:
+	uint32_t mGeneration;
 };
 
 BIO_SINGLETON(GlobalCache, Cache)
@@ -76,3 +76,15 @@
 #ifndef BIO_ENABLE_REFLECTION
 	#define BIO_ENABLE_REFLECTION 1
 #endif
+
+/**
+ * Identifiable objects may be compared to Ids & Names very often (e.g. when seeking through Lines). <br />
+ * With BIO_STRICT_ID_EQUALITY, comparing an Identifiable to an Id only compares the Ids and comparing to a Name does not go through the Perspective (unless BIO_MEMORY_OPTIMIZE_LEVEL prevents Names from being stored). <br />
+ * Without it, each comparison double checks the Name of *this with its Perspective, case insensitively. <br />
+ * The double check is always available through Identifiable::IsIdVerified(). <br />
+ * To restore the double check for all comparisons, <br />
+ * #define BIO_STRICT_ID_EQUALITY 0 <br />
+ */
+#ifndef BIO_STRICT_ID_EQUALITY
+	#define BIO_STRICT_ID_EQUALITY 1
+#endif
@@ -72,6 +72,16 @@ public:
 		#endif
 	}
 
+	/**
+	 * @return the ThreadId of the thread calling this.
+	 */
+	static ThreadId GetCurrentThreadId();
+
+	/**
+	 * Let other threads run before the calling thread continues. <br />
+	 */
+	static void YieldThread();
+
 	/**
 	 * YOU MUST CALL STOP BEFORE DESTROYING *this!!!! <br />
 	 */
@@ -24,10 +24,22 @@
 #include <ostream>
 #include "bio/common/type/IsPointer.h"
 
+#if BIO_CPP_VERSION >= 11
+	#include <utility>
+#endif
+
 namespace bio {
 
 //@formatter:off
 
+/**
+ * Give InPlace() as the first argument to a TransparentWrapper (or anything derived from one, like Final<>) to construct the wrapped object directly from the remaining arguments. <br />
+ * Otherwise, the wrapped object is built from a copy of whatever is given. <br />
+ */
+struct InPlace
+{
+};
+
 /**
  * TransparentWrappers should appear to be the type they wrap in all respects.
  * However, this is not currently possible for member access. <br />
@@ -57,6 +69,22 @@ public:
 
 	TransparentWrapper(T t) : mT(t) {}
 	TransparentWrapper(const TransparentWrapper<T>& other) : mT(other.mT) {}
+
+	//START: In place construction (see InPlace, above)
+	#if BIO_CPP_VERSION >= 11
+	template < typename... ARGS >
+	explicit TransparentWrapper(InPlace, ARGS&&... args) : mT(::std::forward< ARGS >(args)...) {}
+	#else
+	explicit TransparentWrapper(InPlace) : mT() {}
+	template < typename ARG1 >
+	TransparentWrapper(InPlace, const ARG1& arg1) : mT(arg1) {}
+	template < typename ARG1, typename ARG2 >
+	TransparentWrapper(InPlace, const ARG1& arg1, const ARG2& arg2) : mT(arg1, arg2) {}
+	template < typename ARG1, typename ARG2, typename ARG3 >
+	TransparentWrapper(InPlace, const ARG1& arg1, const ARG2& arg2, const ARG3& arg3) : mT(arg1, arg2, arg3) {}
+	#endif
+	//END: In place construction
+
     virtual ~TransparentWrapper()
 	{
 		#if BIO_CPP_VERSION >= 17
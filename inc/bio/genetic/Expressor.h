@@ -94,6 +94,54 @@ public:
 		return code::NotImplemented();
 	}
 
+	/**
+	 * Add the default Protein of the given Name to *this, without creating a new Protein. <br />
+	 * The Protein is shared with every other Expressor which does the same (see Proteome.h), so it must not be changed through *this. <br />
+	 * Use this in CreateDefaultProteins() for Proteins which do nothing by default and whose Surfaces are not Bound during use. <br />
+	 * @param name
+	 * @return the shared Protein or NULL.
+	 */
+	molecular::Protein* ShareDefaultProtein(const Name& name);
+
+	/**
+	 * Id based version of ShareDefaultProtein(Name). <br />
+	 * @param proteinId
+	 * @return the shared Protein or NULL.
+	 */
+	molecular::Protein* ShareDefaultProtein(const Id& proteinId);
+
+	/**
+	 * Lazy Protein slots. <br />
+	 * PROTEIN BASED methods may invoke (*ExpressProtein(mcMyProtein, MyProteinId()))() rather than (*mcMyProtein)(), where mcMyProtein starts as NULL and MyProteinId() looks up the Id once, on first use (not during static initialization). <br />
+	 * On first use, the slot is filled with the Protein of the given Id in *this. If there is no such Protein, one is created: the default Protein is shared (see ShareDefaultProtein()) or, if !shared, a new Protein owned by *this is added. <br />
+	 * This means Proteins that are never used are never created, and no Names are looked up after the first use. <br />
+	 * @param slot the cached Protein* to fill; left untouched if already set.
+	 * @param proteinId
+	 * @param shared whether or not the default Protein may be shared; use false for Proteins whose Surfaces are Bound during use.
+	 * @return slot
+	 */
+	molecular::Protein* ExpressProtein(
+		molecular::Protein*& slot,
+		const Id& proteinId,
+		bool shared = true
+	);
+
+	/**
+	 * Copy on write for Proteins added with ShareDefaultProtein(). <br />
+	 * If the Protein of the given Id is shared, *this gets its own copy of it and CacheProteins() is called again, so that any cached pointers refer to the new copy. <br />
+	 * Call this before changing (e.g. adding sub-Proteins to) any Protein you did not create yourself. <br />
+	 * @param proteinId
+	 * @return a Protein in *this which may be changed or NULL.
+	 */
+	molecular::Protein* CustomizeProtein(const Id& proteinId);
+
+	/**
+	 * Ease of use wrapper around CustomizeProtein(Id). <br />
+	 * @param proteinName
+	 * @return a Protein in *this which may be changed or NULL.
+	 */
+	molecular::Protein* CustomizeProtein(const Name& proteinName);
+
 	/**
 	 * Apoptosis is "programmed cell death". <br />
 	 * This provides an easy, virtual destruction process, which is something most Expressors will find useful. <br />
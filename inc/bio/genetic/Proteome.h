@@ -0,0 +1,79 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "bio/molecular/Protein.h"
+
+#include <map>
+
+namespace bio {
+namespace genetic {
+
+/**
+ * The Proteome holds the default Proteins that Expressors share. <br />
+ * Most Expressors create a number of Proteins which do nothing until a Plasmid gives them something to do. Rather than every instance allocating its own copy of each, Expressors may ShareDefaultProtein(), which adds the single Proteome-owned Protein of that Name. <br />
+ * Default Proteins are immutable: an Expressor must CustomizeProtein() before changing one, which gives it its own copy (copy on write). <br />
+ * NOTE: do not share Proteins whose Surfaces are Bound during use (e.g. to pass arguments); those should remain per instance. <br />
+ *
+ * The Proteome is a singleton to match the Genome. <br />
+ */
+class ProteomeImplementation :
+	virtual public ThreadSafe
+{
+public:
+	ProteomeImplementation();
+
+	/**
+	 * Deletes all default Proteins. <br />
+	 */
+	virtual ~ProteomeImplementation();
+
+	/**
+	 * Get the default Protein with the given Name, creating it if necessary. <br />
+	 * The returned Protein is owned by *this & shared by all callers; do not change it. <br />
+	 * @param name
+	 * @return a shared, default Protein.
+	 */
+	molecular::Protein* GetDefault(const Name& name);
+
+	/**
+	 * Id based version of GetDefault(Name). <br />
+	 * @param id
+	 * @return a shared, default Protein.
+	 */
+	molecular::Protein* GetDefault(const Id& id);
+
+	/**
+	 * @return how many default Proteins have been created.
+	 */
+	::std::size_t GetNumberOfDefaults() const;
+
+protected:
+	typedef ::std::map< Id, molecular::Protein* > Defaults;
+	Defaults mDefaults;
+};
+
+BIO_SINGLETON(Proteome, ProteomeImplementation)
+
+} //genetic namespace
+} //bio namespace
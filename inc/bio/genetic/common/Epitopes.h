@@ -0,0 +1,54 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Types.h"
+
+namespace bio {
+namespace epitope {
+
+/**
+ * Peptidases of this Epitope find a place (e.g. by Name). <br />
+ * Used by Localization. <br />
+ */
+Epitope Move();
+
+/**
+ * Peptidases of this Epitope add something to a place. <br />
+ * Used by Insertion. <br />
+ */
+Epitope Insert();
+
+/**
+ * Peptidases of this Epitope give the chemical::Revision of a place. <br />
+ * Used by compiled Localizations. <br />
+ */
+Epitope Revision();
+
+/**
+ * Peptidases of this Epitope find a place (e.g. by Name) and make sure it is owned by the Substance it was found in, so that it may be changed. <br />
+ * Used by Insertion. <br />
+ */
+Epitope Unshare();
+
+} //epitope namespace
+} //bio namespace
@@ -65,11 +65,19 @@ public:
 	 * Override of Localization system. <br />
 	 * This is what does the inserting. <br />
 	 * Will recurse upward, following mPrevious for as long as possible. <br />
+	 * Since we change the place we find, the places before it are found with SeekToWrite(), so Shared Contents are copied before they are changed. <br />
 	 * @param insertIn
 	 * @return a Substance somewhere within the Substance provided or NULL.
 	 */
 	virtual chemical::Substance* Seek(chemical::Substance* insertIn) const;
 
+	/**
+	 * What we insert is always owned by where we insert it, so this is the same as Seek(). <br />
+	 * @param insertIn
+	 * @return Seek(insertIn).
+	 */
+	virtual chemical::Substance* SeekToWrite(chemical::Substance* insertIn) const;
+
 	/**
 	 * Tells *this to insert toInsert in its Localization. <br />
 	 * @param toInsert
@@ -22,6 +22,7 @@
 #pragma once
 
 #include "bio/genetic/common/Types.h"
+#include "bio/genetic/common/Epitopes.h"
 #include "bio/genetic/relativity/Translocator.h"
 #include "bio/physical/common/Class.h"
 #include "bio/physical/macro/Macros.h"
@@ -55,6 +56,10 @@ class Localization;
  * And, lastly, instantiate a Localization. <br />
  * If you would like to identify a place within another place, simple repeat and Modulate the first Localization with the second. <br />
  * For example, if you want to identify where the bathroom is within a restaurant, we would start with a Localization like {location::Room(), "Bathroom"}, which might cause us to ask the nearest person for the "Bathroom". Next, we would create another Localization along the lines of {location::StreetAddress(), "MyFavoriteRestaurant"}. In this case, StreetAddress would tell us to use a navigation app and maybe a car or taxi service to "extract" the restaurant form the world. Then, we say bathroomLocalization % restaurantLocalization. Thus, we end up with all the information necessary to "extract" the "Bathroom" from "MyFavoriteRestaurant". <br />
+ * <br />
+ * Localizations may be Compile()d. A Compiled Localization remembers where each of its hops led and will follow those cached pointers on later Seeks, rather than looking each place up by Name again. <br />
+ * Each hop is only reused while the Motif it was Sought through keeps the same chemical::Revision and the Substance Sought in has not changed. Once either changes, that hop is looked up again and re-cached. <br />
+ * Renaming the Contents of a Motif does not change its Revision, so please Decompile() (or re-Compile()) any Localization that depends on Names you change. <br />
  */
 class Localization :
 	physical::Class< Localization >
@@ -89,6 +94,14 @@ public:
 	 */
 	virtual chemical::Substance* Seek(chemical::Substance* seekIn) const;
 
+	/**
+	 * Like Seek() but for places that are about to be changed (e.g. by an Insertion). <br />
+	 * Every place found along the way is Unshared (see chemical::LinearMotif::UnshareImplementation()), so changing it will not change the same place in any other Substance. <br />
+	 * @param seekIn
+	 * @return a Substance somewhere within the Substance provided, owned by the Substance it was found in, or NULL.
+	 */
+	virtual chemical::Substance* SeekToWrite(chemical::Substance* seekIn) const;
+
 	/**
 	 * Get mLocation. <br />
 	 * @return mLocation.
@@ -113,6 +126,23 @@ public:
 	 */
 	virtual void SetNameOfLocation(const Name& name);
 
+	/**
+	 * Start caching the results of Seek() in *this and all Localizations *this has been Modulated with. <br />
+	 * See the class description for more info. <br />
+	 */
+	virtual void Compile();
+
+	/**
+	 * Stop caching the results of Seek() in *this and all Localizations *this has been Modulated with. <br />
+	 * Anything already cached is forgotten. <br />
+	 */
+	virtual void Decompile();
+
+	/**
+	 * @return whether or not *this caches the results of Seek().
+	 */
+	virtual bool IsCompiled() const;
+
 protected:
 	/**
 	 * To be run at the top of Seek. <br />
@@ -121,10 +151,49 @@ protected:
 	 */
 	chemical::Substance* ResolvePrevious(chemical::Substance* seekIn) const;
 
+	/**
+	 * ResolvePrevious() for SeekToWrite(). <br />
+	 * @param seekIn
+	 * @return the result of Seeking to write through all Modulated Localizations.
+	 */
+	chemical::Substance* ResolvePreviousToWrite(chemical::Substance* seekIn) const;
+
+	/**
+	 * Uses the "Revision" peptidase of mLocation to check the structure of a Substance. <br />
+	 * @param seekIn
+	 * @return the Revision of the Motif mLocation would Seek through in seekIn or 0.
+	 */
+	chemical::Revision GetRevisionOf(chemical::Substance* seekIn) const;
+
+	/**
+	 * Forget whatever Seek() has cached. <br />
+	 */
+	void ClearCompilation() const;
+
+	/**
+	 * Our peptidase is only copied from the Translocator the first time it is needed, since we have to EditArg() it. <br />
+	 * @return mcMethod, cloning it from the Translocator if necessary.
+	 */
+	chemical::ExcitationBase* GetMethod() const;
+
+	/**
+	 * Like GetMethod() but for the "Unshare" peptidase of mLocation. <br />
+	 * @return mcUnshareMethod, cloning it from the Translocator if necessary.
+	 */
+	chemical::ExcitationBase* GetUnshareMethod() const;
+
 	Location mLocation;
 	Name mName;
 	Localization* mPrevious;
-	chemical::ExcitationBase* mcMethod; //cached pointer to location-associated function pointer.
+	Epitope mEpitope; //which peptidase of mLocation to use.
+	mutable chemical::ExcitationBase* mcMethod; //our own copy of the location-associated function pointer.
+	mutable chemical::ExcitationBase* mcUnshareMethod; //our own copy of the location-associated Unshare function; used by SeekToWrite().
+	const chemical::ExcitationBase* mcRevisionMethod; //shared pointer to the location-associated Revision function; owned by the Translocator.
+
+	bool mIsCompiled;
+	mutable chemical::Substance* mcSoughtIn; //where the last compiled hop started.
+	mutable chemical::Substance* mcSought; //where the last compiled hop ended.
+	mutable chemical::Revision mcRevision; //the Revision of mcSoughtIn when mcSought was found.
 };
 
 } //genetic namespace
@@ -42,11 +42,33 @@
             )                                                                  \
         );
 
+/**
+ * This is not for you either. <br />
+ * Registers the "Revision" Epitope, which lets Localizations check whether the Motif they Sought through has changed. <br />
+ */
+#define BIO_TRANSLOCATION_REVISION_FUNCTION(location, type)                    \
+    bool g##location##RevisionRegistered =                                     \
+        SafelyAccess< ::bio::genetic::Translocator >()                         \
+			->AssociateSignalPeptidase(                                        \
+            ::bio::genetic::Translocator::Instance().GetIdFromName(#location), \
+            ::bio::EpitopePerspective::Instance().GetIdFromName("Revision"),   \
+            (                                                                  \
+                new BIO_EXCITATION_CLASS(                                      \
+                    ::bio::chemical::LinearMotif< type >,                      \
+                    ::bio::chemical::Revision                                  \
+                )(                                                             \
+                    &::bio::chemical::LinearMotif< type >::GetRevisionImplementation \
+                )                                                              \
+            )                                                                  \
+        );
+
 /**
  * Ease of use method of defining all kinds of sites at once. <br />
  * This will automatically define peptidases (chemical::Excitation*) for the following affinities at your Location: <br />
  * * "Move" <br />
  * * "Insert" <br />
+ * * "Unshare" <br />
+ * * "Revision" <br />
  */
 #define BIO_LOCATION_FUNCTION_BODY(functionName, type)                         \
     namespace location {                                                       \
@@ -68,4 +90,14 @@
 			AddImplementation,                                                 \
 			(type),                                                            \
 			(NULL))                                                            \
+        BIO_TRANSLOCATION_FUNCTION(                                            \
+		    functionName,                                                      \
+			Unshare,                                                           \
+			type,                                                              \
+			UnshareByNameImplementation,                                       \
+			(const Name&),                                                     \
+			(NULL))                                                            \
+        BIO_TRANSLOCATION_REVISION_FUNCTION(                                   \
+		    functionName,                                                      \
+			type)                                                              \
     }
@@ -48,3 +48,12 @@ BIO_ID_FUNCTION_BODY(                                                          \
     functionName,                                                              \
     ::bio::TranscriptionFactorPerspective::Instance(),                         \
     ::bio::TranscriptionFactor)
+
+/**
+Macro for defining Epitopes.
+*/
+#define BIO_EPITOPE_FUNCTION_BODY(functionName)                                \
+BIO_ID_FUNCTION_BODY(                                                          \
+    functionName,                                                              \
+    ::bio::EpitopePerspective::Instance(),                                     \
+    ::bio::Epitope)
@@ -25,7 +25,13 @@
 #include "bio/physical/string/TypedBrane.h"
 #include "bio/genetic/common/Types.h"
 
+#include <map>
+
 namespace bio {
+namespace chemical {
+class ExcitationBase;
+} //chemical namespace
+
 namespace genetic {
 
 /**
@@ -67,6 +73,12 @@ public:
 	 * Here, we treat Peptidases as the means by which a SignalPeptide effects the placement of a Gene. The type associated with each Epitope is a different Excitation which may be performed in order to move the associated Gene into the next (and eventually final) Location. <br />
 	 */
 	physical::TypedPerspective< Epitope > mPeptidases;
+
+	/**
+	 * The Excitation behind each type in mPeptidases, by peptidase id. <br />
+	 * mPeptidases only holds the Wave of each Excitation, which cannot be cast back to an ExcitationBase (the ExcitationBase is not the first base of an Excitation). <br />
+	 */
+	::std::map< Epitope, chemical::ExcitationBase* > mExcitations;
 };
 
 } //genetic namespace
@@ -77,25 +77,53 @@ public:
 
 	/**
 	 * Get a previously Associated Excitation for the given epitope at the given location. <br />
+	 * The returned Excitation is shared by all callers and is owned by *this: do not modify or delete it! <br />
+	 * Results are memoized in a Location x Epitope table, so repeated lookups are a pair of array accesses. <br />
+	 * If you need to change the Excitation (e.g. EditArg()), use ClonePeptidase() instead. <br />
+	 * @param location
+	 * @param epitope
+	 * @return a shared chemical::Excitation* or NULL
+	 */
+	const chemical::ExcitationBase* GetPeptidase(
+		Location location,
+		Epitope epitope
+	);
+
+	/**
+	 * Get a previously Associated Excitation for the given epitope at the given location. <br />
+	 * The returned Excitation is shared by all callers and is owned by *this: do not modify or delete it! <br />
+	 * @param location
+	 * @param epitope
+	 * @return a shared chemical::Excitation* or NULL
+	 */
+	const chemical::ExcitationBase* GetPeptidase(
+		Location location,
+		const Name& epitope
+	);
+
+	/**
+	 * Get a copy of a previously Associated Excitation for the given epitope at the given location. <br />
 	 * Make sure to delete the returned Excitation! <br />
 	 * @param location
 	 * @param epitope
 	 * @return a new chemical::Excitation* or NULL
 	 */
-	chemical::ExcitationBase* GetPeptidase(
+	chemical::ExcitationBase* ClonePeptidase(
 		Location location,
-		Epitope epitope);
+		Epitope epitope
+	);
 
 	/**
-	 * Get a previously Associated Excitation for the given epitope at the given location. <br />
+	 * Get a copy of a previously Associated Excitation for the given epitope at the given location. <br />
 	 * Make sure to delete the returned Excitation! <br />
 	 * @param location
 	 * @param epitope
 	 * @return a new chemical::Excitation* or NULL
 	 */
-	chemical::ExcitationBase* GetPeptidase(
+	chemical::ExcitationBase* ClonePeptidase(
 		Location location,
-		const Name& epitope);
+		const Name& epitope
+	);
 
 
 protected:
@@ -106,6 +134,49 @@ protected:
 	 * @return a new SignalPeptide.
 	 */
 	virtual physical::Brane< Location >* CreateBrane(Location id, const Name& name);
+
+	/**
+	 * A memoized result of FindPeptidase(). <br />
+	 * mPeptidase may be NULL once mIsKnown, so that misses are not looked up again. <br />
+	 */
+	struct PeptidaseEntry
+	{
+		const chemical::ExcitationBase* mPeptidase;
+		bool mIsKnown;
+	};
+
+	/**
+	 * Finds the Excitation Associated with the given location and epitope without consulting mPeptidaseTable. <br />
+	 * @param location
+	 * @param epitope
+	 * @return the Associated Excitation or NULL.
+	 */
+	const chemical::ExcitationBase* FindPeptidase(
+		Location location,
+		Epitope epitope
+	);
+
+	/**
+	 * @param location
+	 * @param epitope
+	 * @return the mPeptidaseTable entry for the given location and epitope.
+	 */
+	PeptidaseEntry& AccessPeptidaseTable(
+		Location location,
+		Epitope epitope
+	);
+
+	/**
+	 * Both Locations and Epitopes are uint8_t, so we can index every possible pair directly. <br />
+	 * Rows (Locations) are only allocated once they are used. <br />
+	 */
+	static const unsigned int sPeptidaseTableSize = 256;
+
+	/**
+	 * Memoized results of FindPeptidase(), indexed by [Location][Epitope]. <br />
+	 * Entries are kept current by AssociateSignalPeptidase() and DisassociateSignalPeptidase(). <br />
+	 */
+	PeptidaseEntry* mPeptidaseTable[sPeptidaseTableSize];
 };
 
 BIO_SINGLETON(Translocator, TranslocatorImplementation)
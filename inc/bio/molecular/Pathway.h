@@ -25,6 +25,8 @@
 #include "bio/chemical/reaction/Reaction.h"
 #include "bio/chemical/structure/motif/LinearMotif.h"
 
+#include <vector>
+
 namespace bio {
 namespace molecular {
 
@@ -41,6 +43,12 @@ namespace molecular {
  * The last call to Add<Reaction*>() will be the last Reaction called and will determine the ultimate Products returned by *this Process, should it successfully run to completion. <br />
  * i.e. return last(middle(first(reactants))); <br />
  *
+ * Before its first Process, a Pathway Compile()s its Reactions into a flat list of steps, noting which steps have Requirements. <br />
+ * Nothing is checked when Compiling: Reactions do not declare their Products, so whether one step's Products will meet the next step's Requirements is only known when *this is Processed. <br />
+ * Thus, steps with Requirements check the Products of the previous step (through Reaction::operator()) each time they run; steps without Requirements are Processed directly. <br />
+ * The Products of each step are copied into one intermediate Reactants, which is reused for every step (see chemical::Reactants::Replace()). <br />
+ * Adding or removing Reactions changes the chemical::Revision of *this, after which the next Process will Compile() again. <br />
+ *
  * TODO: Add switching logic for Products Code. <br />
  */
 class Pathway :
@@ -57,7 +65,7 @@ public:
 	/**
 	 * Standard constructors. <br />
 	 */
-	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS(
+	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS_WITH_COMMON_CONSTRUCTOR(
 		chemical,
 		Pathway,
 		filter::Chemical()
@@ -74,7 +82,7 @@ public:
 	 * @param reactants
 	 * @return the Products from the last Reaction or a code::FailedReaction(), if any step did not succeed.
 	 */
-	virtual chemical::Products Process(chemical::Reactants* reactants);
+	virtual chemical::Products Process(chemical::Reactants* reactants) const;
 
 	/**
 	 * *this shouldn't have an Requirements / Reactants, so instead we check the first Reaction in *this. <br />
@@ -82,6 +90,36 @@ public:
 	 * @return whether or not the first Reaction in *this can use the given Substances.
 	 */
 	virtual bool ReactantsMeetRequirements(const chemical::Reactants* toCheck) const;
+
+	/**
+	 * @return whether or not the first Reaction in *this has Requirements.
+	 */
+	virtual bool HasRequirements() const;
+
+	/**
+	 * Flatten the Reactions in *this into steps and note which steps have Requirements (and so must check their Reactants when Processed). <br />
+	 * This does not check that the steps fit together. <br />
+	 * This is done automatically by Process() whenever the Reactions in *this change (see chemical::Revision). <br />
+	 * @return code::Success() or code::BadArgument1(), if *this contains an invalid Reaction (e.g. itself).
+	 */
+	Code Compile() const;
+
+protected:
+
+	/**
+	 * Set up members. <br />
+	 */
+	void CommonConstructor();
+
+	/**
+	 * @return whether or not mSteps matches the Reactions in *this.
+	 */
+	bool IsCompiled() const;
+
+	mutable ::std::vector< const chemical::Reaction* > mSteps;
+	mutable ::std::vector< uint8_t > mCheckSteps;
+	mutable const Pathway* mCompiledFor; //Copies of *this hold copies of our Reactions, so they must Compile() themselves.
+	mutable chemical::Revision mCompiledRevision; //the Revision of our Reactions when mSteps was built.
 };
 
 } //molecular namespace
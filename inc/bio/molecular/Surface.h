@@ -27,6 +27,12 @@
 #include "bio/molecular/macro/Macros.h"
 #include "bio/chemical/EnvironmentDependent.h"
 
+//@formatter:off
+#if BIO_CPP_VERSION >= 11
+	#include <atomic>
+#endif
+//@formatter:on
+
 namespace bio {
 namespace molecular {
 
@@ -62,9 +68,10 @@ public:
 	);
 
 	/**
-	 * Copying a Surface generates a new set of Molecules and will Clone any Manage()d Waves from toCopy into *this. <br />
+	 * Copying a Surface shares the Manage()d Waves of toCopy with *this. <br />
+	 * They are only Cloned (copy on write) once either Surface changes what it holds (e.g. through Bind, Manage, Release, or the non-const Probe). <br />
 	 * NOTE: all Use()d Waves will be lost. Since *this does not control what it Uses, it cannot (will not) duplicate it. <br />
-	 * Keep in mind that *this will delete all Managed Waves on destruction. <br />
+	 * Keep in mind that *this will delete all Managed Waves on destruction, unless they are still shared. <br />
 	 * @param toCopy
 	 */
 	Surface(const Surface& toCopy);
@@ -100,6 +107,7 @@ public:
 	{
 		BIO_STATIC_ASSERT(!type::IsPointer< T >())
 
+		Unshare();
 		chemical::AtomicNumber bondedId = GetBondId< T >();
 		mBoundPosition = FormBondImplementation(
 			(new physical::Quantum< T >(varPtr))->AsWave(),
@@ -136,6 +144,7 @@ public:
 	/**
 	 * Probe is the Biology style "get". <br />
 	 * This is a simple wrapper around Atom::As<>(). If you need to Get the T* *this is Bound to, use As directly. <br />
+	 * Since what is returned may be changed, this stops sharing Managed Waves with any copies (see the copy constructor). Use the const version to only read. <br />
 	 * @tparam T a non-pointer type that is Bound to *this.
 	 * @return a T that is Bound to *this or 0.
 	 */
@@ -144,6 +153,25 @@ public:
 	{
 		BIO_STATIC_ASSERT(!type::IsPointer< T >())
 
+		Unshare();
+		BIO_SANITIZE(mBoundPosition,,return 0)
+		BIO_SANITIZE(mBonds.IsAllocated(mBoundPosition),,return 0)
+
+		T* ret = this->As< T* >();
+		return *ret;
+	}
+
+	/**
+	 * Probe is the Biology style "get". <br />
+	 * Reading a Surface never Clones what it shares with its copies. <br />
+	 * @tparam T a non-pointer type that is Bound to *this.
+	 * @return a T that is Bound to *this or 0.
+	 */
+	template < typename T >
+	const T& Probe() const
+	{
+		BIO_STATIC_ASSERT(!type::IsPointer< T >())
+
 		BIO_SANITIZE(mBoundPosition,,return 0)
 		BIO_SANITIZE(mBonds.IsAllocated(mBoundPosition),,return 0)
 
@@ -168,6 +196,7 @@ public:
 		BondType bondType = bond_type::Temporary())
 	{
 		BIO_STATIC_ASSERT(!type::IsPointer< T >());
+		Unshare();
 		if (mBoundPosition)
 		{
 			T* bound = As< T* >();
@@ -285,10 +314,45 @@ public:
 	virtual physical::Waves operator--();
 
 protected:
+
+	/**
+	 * Stop counting *this among the holders of its Managed Waves. <br />
+	 * The count is decremented and tested at once, so only 1 holder ever sees it reach 0 (and deletes it). <br />
+	 * @return whether or not the Managed Waves of *this are still held by a copy of *this (or the Surface *this copied).
+	 */
+	bool DropShare();
+
+	/**
+	 * Give *this its own Clone of each Managed Wave it shares. <br />
+	 * Call this before changing anything *this holds. <br />
+	 */
+	void Unshare();
+
 	/**
 	 * should be 0 or 1 in practice (i.e. we prevent >1 Binding).
 	 */
 	chemical::Valence mBoundPosition;
+
+#if BIO_CPP_VERSION >= 11
+	typedef ::std::atomic< Index > ShareCount;
+#else
+	typedef Index ShareCount;
+#endif
+
+	/**
+	 * How many Surfaces (including *this) share the Managed Waves of *this. <br />
+	 * NULL if *this has never been copied. <br />
+	 * NOTE: before C++11, this is not atomic, so Surfaces which share Waves should not be copied, changed, or destroyed on different threads at the same time. <br />
+	 */
+	mutable ShareCount* mShareCount;
+
+private:
+
+	/**
+	 * Assignment would alias mShareCount without counting *this, so it is disallowed; use the copy ctor instead. <br />
+	 * Declared but never defined. <br />
+	 */
+	Surface& operator=(const Surface& toAssign);
 };
 
 } //molecular namespace
@@ -22,6 +22,7 @@
 #pragma once
 
 #include "Neurite.h"
+#include "bio/neural/tissue/Glia.h"
 
 namespace bio {
 namespace neural {
@@ -37,7 +38,7 @@ public:
 	 */
 	BIO_DISAMBIGUATE_ALL_CLASS_METHODS(neural, Axon)
 
-	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS(
+	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS_WITH_COMMON_CONSTRUCTOR(
 		neural,
 		Axon,
 		filter::Neural()
@@ -127,6 +128,12 @@ public:
 	Id GetPresynapticId() const;
 
 protected:
+
+	/**
+	 * Empties our Protein slots. <br />
+	 */
+	void CommonConstructor();
+
 	const Neuron* mPresynapticNeuron;
 
 	molecular::Protein* mcProcessOutgoing;
@@ -139,6 +146,13 @@ protected:
 	 * How long until *this should be removed. <br />
 	 */
 	Milliseconds mTimeout;
+
+	/**
+	 * Where *this is within the fan-out of the Glia that Ensheathed it, if any. <br />
+	 */
+	Sheath mSheath;
+
+	friend class Glia;
 };
 
 } // neural namespace
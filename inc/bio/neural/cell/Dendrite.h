@@ -22,6 +22,7 @@
 #pragma once
 
 #include "Neurite.h"
+#include "bio/neural/tissue/Glia.h"
 
 namespace bio {
 namespace neural {
@@ -37,7 +38,7 @@ public:
 	 */
 	BIO_DISAMBIGUATE_ALL_CLASS_METHODS(neural, Dendrite)
 
-	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS(
+	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS_WITH_COMMON_CONSTRUCTOR(
 		neural,
 		Dendrite,
 		filter::Neural()
@@ -131,6 +132,19 @@ public:
 	 */
 	virtual Timestamp GetTimeToAdd() const;
 
+	/**
+	 * Dendrites are only Depotentiated when new data arrive, so this is never by default. <br />
+	 * Override this if your Dendrite expires on its own (see Synapse). <br />
+	 * @return the timestamp after which *this should be removed from the target, if it has been added.
+	 */
+	virtual Timestamp GetTimeToDepotentiate() const;
+
+	/**
+	 * If *this has been Ensheathed by Glia (see Neuropil::Batch()), update the values they mirror. <br />
+	 * This is called automatically whenever *this changes a mirrored value. <br />
+	 */
+	void UpdateGlia();
+
 	/**
 	 * @return what *this sends data to, the target.
 	 */
@@ -152,6 +166,12 @@ public:
 	Id GetPostsynapticId() const;
 
 protected:
+
+	/**
+	 * Empties our Protein slots. <br />
+	 */
+	void CommonConstructor();
+
 	Neuron* mPostsynapticNeuron;
 
 	molecular::Protein* mcPrepareForPotentiation;
@@ -172,6 +192,12 @@ protected:
 	 */
 	Id mPostsynapticNeuronId;
 
+	/**
+	 * Where *this is within the Glia that Ensheathed it, if any. <br />
+	 */
+	Sheath mSheath;
+
+	friend class Glia;
 
 	/**
 	 * What to do when *this is no longer ready to be potentiated. <br />
@@ -37,7 +37,7 @@ public:
 	 */
 	BIO_DISAMBIGUATE_ALL_CLASS_METHODS(neural, Neurite)
 
-	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS(
+	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS_WITH_COMMON_CONSTRUCTOR(
 		neural,
 		Neurite,
 		filter::Neural()
@@ -76,6 +76,12 @@ public:
 	virtual void MakeZero();
 
 protected:
+
+	/**
+	 * Empties our Protein slots. <br />
+	 */
+	void CommonConstructor();
+
 	molecular::Protein* mcIsZero;
 	molecular::Protein* mcMakeZero;
 };
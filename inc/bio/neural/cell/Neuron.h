@@ -23,6 +23,7 @@
 
 #include "Synapse.h"
 #include "bio/neural/Impulse.h"
+#include "bio/neural/tissue/Glia.h"
 
 namespace bio {
 namespace neural {
@@ -257,6 +258,18 @@ public:
 		const Synapse* synapseType
 	);
 
+	/**
+	 * Like ConnectTo but WITHOUT checking whether an identical Synapse already exists. <br />
+	 * This is used by AxonGuides, which check for duplicates once for all the Synapses they create. <br />
+	 * @param target: the Neuron to send data to.
+	 * @param synapseType: the Synapse to use to send data.
+	 * @return: the configured Synapse that has been added to *this. <br/>
+	 */
+	Synapse* GrowAxonTo(
+		Neuron* target,
+		const Synapse* synapseType
+	);
+
 	/**
 	 * RequestProcessingOf checks if the data coming from the given Dendrite should be added (or removed) and will perform the necessary proteins. <br />
 	 * The only reason to use this method, as opposed to letting Crest check the given Dendrite, is to have it be processed before another Dendrite i.e. this method gives you more control over the order in which Dendrites are processed. With that said, Crest will still process Dendrite in the order they are added, it will just skip any Dendrites which have already been processed, either by a previous Crest or by this method. <br />
@@ -272,6 +285,7 @@ public:
 
 	/**
 	 * Calls Synapse::ProcessOutgoing for each Axon. <br />
+	 * When *this has been Ensheathed and no selection is given, the Axons are read from the Glia's contiguous fan-out rather than from *this. <br />
 	 * @param selection (optional) the Affinity to use for selecting which Axons to send data through.
 	 */
 	virtual Code Transmit(Affinity* selection = NULL);
@@ -293,6 +307,12 @@ public:
 
 	//START: These are not for you.
 
+	/**
+	 * If *this has been Ensheathed by Glia (see Neuropil::Batch()), update the values they mirror. <br />
+	 * This is called automatically whenever *this changes a mirrored value. <br />
+	 */
+	void UpdateGlia();
+
 	/**
 	 * physical::Periodic method; called every clock tick. <br />
 	 * Performs all upkeep operations. <br />
@@ -317,6 +337,13 @@ protected:
 
 	virtual void CommonConstructor();
 
+	/**
+	 * Calls ProcessOutgoing on the given Axon, logging any failure. <br />
+	 * @param axon
+	 * @return the Code to add to the result of Transmit().
+	 */
+	Code TransmitThrough(Axon* axon);
+
 	/**
 	 * Proteins (see cellular::Cell.h for more information)
 	 */
@@ -361,6 +388,13 @@ protected:
 	 */
 	virtual Code ProcessDendrite(Dendrite* dendrite);
 
+	/**
+	 * Where *this is within the Glia that Ensheathed it, if any. <br />
+	 */
+	Sheath mSheath;
+
+	friend class Glia;
+
 private:
 	Timestamp mLastActive;
 
@@ -58,7 +58,7 @@ public:
 	 */
 	BIO_DISAMBIGUATE_ALL_CLASS_METHODS(neural, Synapse)
 
-	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS(
+	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS_WITH_COMMON_CONSTRUCTOR(
 		neural,
 		Synapse,
 		filter::Neural()
@@ -133,7 +133,25 @@ public:
 	 */
 	virtual void ExtendTimeoutUntil(Timestamp timeToDepotentiate);
 
+	/**
+	 * Override of Axon method; see that class for details. <br />
+	 * @param lastFor
+	 */
+	virtual void SetTimeout(Milliseconds lastFor);
+
+	/**
+	 * Override of Dendrite method; see that class for details. <br />
+	 * @return when *this times out, if it has the Timeout Feature.
+	 */
+	virtual Timestamp GetTimeToDepotentiate() const;
+
 protected:
+
+	/**
+	 * Empties our Protein slots. <br />
+	 */
+	void CommonConstructor();
+
 	molecular::Protein* mcAdditionalConfiguration;
 };
 
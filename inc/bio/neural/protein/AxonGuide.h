@@ -27,6 +27,8 @@
 #include "bio/neural/macro/Macros.h"
 #include "bio/molecular/Protein.h"
 
+#include <vector>
+
 namespace bio {
 namespace neural {
 
@@ -36,6 +38,11 @@ class Neuropil;
  * AxonGuide Proteins assist Neuropils in creating Synapses. <br />
  * NOTE: This is a HUGE over simplification of the actual process. AxonGuide Proteins here are perhaps most representative of the receptors for the various axon guidance molecules & their concentration gradients. Its as if we assume the molecules to guide axon growth are always present & the Proteins we create are very selectively sensitive. <br />
  * You can create AxonGuide Proteins to connect Neurons in novel ways. For examples, check out the guide folder. <br />
+ * <br />
+ * AxonGuides build connections in bulk: <br />
+ * 1. Fold() filters the candidate Neurons of each Neuropil by their Affinity once. <br />
+ * 2. Activate() (in a child) generates Projections, i.e. pairs of indices into those candidates. <br />
+ * 3. Wire() deduplicates the Projections, skips any Synapses which already exist, and grows the rest, without re-scanning each Neuron's Axons for each new Synapse. <br />
  */
 class AxonGuide:
 	public molecular::Class< AxonGuide >,
@@ -76,9 +83,58 @@ public:
 	 */
 	virtual Code Activate();
 
+	/**
+	 * A Projection is a (presynaptic, postsynaptic) pair of indices into mPresynapticNeurons & mPostsynapticNeurons. <br />
+	 */
+	typedef ::std::pair< ::std::size_t, ::std::size_t > Projection;
+
+	/**
+	 * A set of Projections. <br />
+	 */
+	typedef ::std::vector< Projection > Projections;
+
 protected:
 	Neuropil* mPresynapticNeuropil;
 	Neuropil* mPostsynapticNeuropil;
+
+	/**
+	 * What to connect the Neurons with. <br />
+	 */
+	const Synapse* mSynapse;
+
+	/**
+	 * The Neurons of each Neuropil which matched the given Affinities, if any. <br />
+	 * Populated by Fold(). <br />
+	 */
+	::std::vector< Neuron* > mPresynapticNeurons;
+	::std::vector< Neuron* > mPostsynapticNeurons;
+
+	/**
+	 * The Synapses created by the last Wire(). <br />
+	 */
+	Synapses mSynapses;
+
+	/**
+	 * Populate candidates with all the Neurons in neuropil which are attracted to affinity. <br />
+	 * Each Neuron is evaluated once, regardless of how many Synapses it will form. <br />
+	 * @param neuropil where to look for Neurons.
+	 * @param affinity (optional) which Neurons to keep; all are kept if NULL.
+	 * @param candidates where to put the Neurons found.
+	 */
+	static void Gather(
+		Neuropil* neuropil,
+		const Affinity* affinity,
+		::std::vector< Neuron* >& candidates
+	);
+
+	/**
+	 * Create a Synapse for each of the given Projections. <br />
+	 * Duplicate Projections and those which would duplicate an existing Synapse of the same type are skipped. <br />
+	 * The Synapses created are placed in mSynapses, which is Use()d by the "Synapses" Surface. <br />
+	 * @param projections will be sorted and deduplicated.
+	 * @return code::Success() if all new Synapses could be created.
+	 */
+	Code Wire(Projections& projections);
 };
 
 } //neural namespace
@@ -26,6 +26,10 @@
 namespace bio {
 namespace neural {
 
+/**
+ * Connects the nth presynaptic Neuron to the nth postsynaptic Neuron. <br />
+ * Any Neurons left over in the larger Neuropil are left unconnected. <br />
+ */
 class GuideOneToOne:
 	public molecular::Class< GuideOneToOne >,
 	public AxonGuide
@@ -26,6 +26,11 @@
 namespace bio {
 namespace neural {
 
+/**
+ * Connects each presynaptic Neuron to each postsynaptic Neuron with some probability. <br />
+ * The connections made are determined entirely by the seed, the probability, and the order of the candidate Neurons, regardless of how many threads are used to generate them. <br />
+ * Rather than rolling for every pair, the gap to the next connection is drawn from a geometric distribution, so the cost scales with the number of Synapses, not the number of pairs. <br />
+ */
 class GuideRandom:
 	public molecular::Class< GuideRandom >,
 	public AxonGuide
@@ -37,7 +42,7 @@ public:
 	 */
 	BIO_DISAMBIGUATE_ALL_CLASS_METHODS(molecular, GuideRandom)
 
-	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS(
+	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS_WITH_COMMON_CONSTRUCTOR(
 		molecular,
 		GuideRandom,
 		filter::Neural()
@@ -54,6 +59,35 @@ public:
 	 * @return result of Activation.
 	 */
 	virtual Code Activate();
+
+	/**
+	 * @param probability the chance that any presynaptic Neuron will connect to any postsynaptic Neuron; 0.1 by default.
+	 */
+	void SetConnectionProbability(float probability);
+
+	/**
+	 * @return the chance that any presynaptic Neuron will connect to any postsynaptic Neuron.
+	 */
+	float GetConnectionProbability() const;
+
+	/**
+	 * @param seed what determines the connections made; 0 by default.
+	 */
+	void SetSeed(uint64_t seed);
+
+	/**
+	 * @return what determines the connections made.
+	 */
+	uint64_t GetSeed() const;
+
+protected:
+	/**
+	 * Sets defaults. <br />
+	 */
+	void CommonConstructor();
+
+	float mConnectionProbability;
+	uint64_t mSeed;
 };
 
 } // namespace neural
@@ -0,0 +1,411 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2023 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "bio/neural/common/Types.h"
+#include "bio/cellular/common/Types.h"
+#include "bio/common/thread/ThreadSafe.h"
+#include "bio/common/TimerWheel.h"
+#include <vector>
+#include <utility>
+
+namespace bio {
+
+namespace cellular {
+class Cell;
+}
+
+namespace neural {
+
+class Glia;
+
+/**
+ * Where a Neuron, Dendrite, or Axon is within the Glia that Ensheathed it. <br />
+ * Copies of an Ensheathed object (e.g. Clones) have not been Ensheathed, so copying a Sheath always yields an empty one. <br />
+ */
+class Sheath
+{
+public:
+	Sheath() :
+		mGlia(NULL),
+		mIndex(0)
+	{
+	}
+
+	Sheath(const Sheath&) :
+		mGlia(NULL),
+		mIndex(0)
+	{
+	}
+
+	Sheath& operator=(const Sheath&)
+	{
+		return *this;
+	}
+
+	Glia* mGlia;
+	::std::size_t mIndex;
+};
+
+/**
+ * Glia support the Neurons of a Neuropil by keeping their most frequently checked values in one place. <br />
+ * Rather than asking every Neuron (and every Dendrite of every Neuron) whether it has work to do on every CheckIn, Glia mirror those values into contiguous arrays (i.e. a struct of arrays). <br />
+ * Tick() then advances all Neurons in a few flat passes over these arrays and only calls into the Neurons (and their Proteins) which actually changed. <br />
+ * <br />
+ * Neurons and Dendrites keep their mirrored values current by calling UpdateGlia() whenever they change them. <br />
+ * UpdateGlia() only queues the change (see RequestMirror()); the queue is applied at the start of the next Tick(), so the mirrored arrays are only ever touched by the thread which Ticks *this. <br />
+ * Values changed by other means (e.g. Adding a State directly or calling SetInterval()) will only be seen once the owning Neuron does work again or once the Neuropil is Batch()ed again. <br />
+ * <br />
+ * Glia also keep the connectivity of their Neurons in compressed sparse row form: the Axons of each Neuron are stored contiguously, so that Neuron::Transmit() can fan out without building a new Container each time. <br />
+ * Synapses made through Neuron::ConnectTo() are added to the Glia of both Neurons incrementally; they are merged into the contiguous arrays at the start of the next Tick(). <br />
+ * Other structural changes (e.g. Adding Dendrites by hand) require the Neuropil to be Batch()ed again. <br />
+ * <br />
+ * Glia may also be event driven. Event driven Glia do not scan all their Neurons on each Tick(). Instead, each Dendrite registers its next deadline (i.e. when it should be potentiated or when its Synapse times out) with a TimerWheel whenever its mirrored values change (e.g. a Synapse is Updated), as does each Neuron with a persistence window. <br />
+ * Tick() then only checks the Dendrites whose timers have expired and only visits the Neurons which own them, so the cost of each Tick() is proportional to the activity of the network, rather than its size. <br />
+ * Scheduling is ThreadSafe, so Synapses may be Updated from other threads. <br />
+ * <br />
+ * Glia are created by Neuropil::Batch(); you should not need to use them directly. <br />
+ */
+class Glia :
+	public ThreadSafe
+{
+public:
+
+	/**
+	 *
+	 */
+	Glia();
+
+	/**
+	 * Will Clear() *this. <br />
+	 */
+	virtual ~Glia();
+
+	/**
+	 * Mirror the given Neuron and all of its Dendrites & Axons into *this. <br />
+	 * The Neuron will be CheckIn()'d by Tick() from now on; it should not be CheckIn()'d elsewhere. <br />
+	 * @param neuron
+	 * @return whether or not the Neuron could be Ensheathed.
+	 */
+	bool Ensheathe(Neuron* neuron);
+
+	/**
+	 * Add a Dendrite to an already Ensheathed Neuron. <br />
+	 * The Dendrite will be merged into *this on the next Tick(). <br />
+	 * @param neuron
+	 * @param dendrite
+	 * @return whether or not the Dendrite could be Ensheathed.
+	 */
+	bool Ensheathe(
+		Neuron* neuron,
+		Dendrite* dendrite
+	);
+
+	/**
+	 * Add an Axon to an already Ensheathed Neuron. <br />
+	 * The Axon will be merged into *this at the start of the next Tick(); GetAxons() will include it until then. <br />
+	 * @param neuron
+	 * @param axon
+	 * @return whether or not the Axon could be Ensheathed.
+	 */
+	bool Ensheathe(
+		Neuron* neuron,
+		Axon* axon
+	);
+
+	/**
+	 * Add a Cell which cannot be Ensheathed (i.e. is not a Neuron). <br />
+	 * Supported Cells are simply CheckIn()'d each Tick(). <br />
+	 * @param cell
+	 */
+	void Support(cellular::Cell* cell);
+
+	/**
+	 * Forget everything. <br />
+	 * All Ensheathed Neurons & Dendrites will stop updating *this. <br />
+	 */
+	void Clear();
+
+	/**
+	 * Copy the mirrored values of the given Neuron into *this. <br />
+	 * Does nothing if the Neuron was not Ensheathed by *this. <br />
+	 * This must only be called from the thread which Ticks *this; use RequestMirror() everywhere else. <br />
+	 * @param neuron
+	 */
+	void Mirror(const Neuron* neuron);
+
+	/**
+	 * Copy the mirrored values of the given Dendrite into *this. <br />
+	 * Does nothing if the Dendrite was not Ensheathed by *this. <br />
+	 * This must only be called from the thread which Ticks *this; use RequestMirror() everywhere else. <br />
+	 * @param dendrite
+	 */
+	void Mirror(const Dendrite* dendrite);
+
+	/**
+	 * Mirror the given Neuron at the start of the next Tick(). <br />
+	 * This is ThreadSafe. <br />
+	 * @param neuron
+	 */
+	void RequestMirror(const Neuron* neuron);
+
+	/**
+	 * Mirror the given Dendrite at the start of the next Tick(). <br />
+	 * This is ThreadSafe. <br />
+	 * @param dendrite
+	 */
+	void RequestMirror(const Dendrite* dendrite);
+
+	/**
+	 * Stop Ticking the given Neuron (e.g. because it is being destroyed). <br />
+	 * @param neuron
+	 */
+	void Forget(const Neuron* neuron);
+
+	/**
+	 * Stop checking the given Dendrite (e.g. because it is being destroyed). <br />
+	 * @param dendrite
+	 */
+	void Forget(const Dendrite* dendrite);
+
+	/**
+	 * Stop sending through the given Axon (e.g. because it is being destroyed). <br />
+	 * @param axon
+	 */
+	void Forget(const Axon* axon);
+
+	/**
+	 * Get all Axons of the given Neuron: those already merged into the contiguous arrays, followed by those waiting to be Grown. <br />
+	 * Forgotten Axons are left as NULL. <br />
+	 * This does not Grow *this, so it is safe to call from within Tick() and from other threads. <br />
+	 * @param neuron
+	 * @param axons will have the Axons of the given Neuron appended to it.
+	 * @return the number of Axons appended; 0 if the Neuron was not Ensheathed by *this.
+	 */
+	::std::size_t GetAxons(
+		const Neuron* neuron,
+		::std::vector< Axon* >& axons
+	) const;
+
+	/**
+	 * Advance all Ensheathed Neurons to the given time. <br />
+	 * This is the batched equivalent of calling Neuron::CheckIn() on each Neuron, except that Neurons with nothing to do (i.e. no Dendrites to process and no change in persistence) will not be called at all. <br />
+	 * @param now
+	 * @return the number of Neurons that had work to do.
+	 */
+	::std::size_t Tick(Timestamp now);
+
+	/**
+	 * Switch between scanning all Neurons on each Tick() and only visiting those with queued events. <br />
+	 * @param eventDriven
+	 */
+	void SetEventDriven(bool eventDriven);
+
+	/**
+	 * @return whether or not *this only visits the Neurons with queued events on each Tick().
+	 */
+	bool IsEventDriven() const;
+
+	/**
+	 * @return how many Neurons *this has Ensheathed.
+	 */
+	::std::size_t GetNumberOfNeurons() const;
+
+	/**
+	 * @return how many Dendrites *this has Ensheathed.
+	 */
+	::std::size_t GetNumberOfDendrites() const;
+
+	/**
+	 * @return how many Axons *this has Ensheathed.
+	 */
+	::std::size_t GetNumberOfAxons() const;
+
+protected:
+
+	/**
+	 * Merge all newly Ensheathed Dendrites & Axons into the contiguous arrays of *this. <br />
+	 * This moves existing Dendrites & Axons, so their Sheaths are updated as well. <br />
+	 * Only called at the start of Tick(). <br />
+	 */
+	void Grow();
+
+	/**
+	 * An index that doesn't exist; used for Sheaths that are waiting to be Grown. <br />
+	 */
+	static const ::std::size_t sNowhere;
+
+	/**
+	 * Calls into the given Neuron, if it has work to do. <br />
+	 * Assumes mPending & mPersistenceLapsed are up to date. <br />
+	 * @param neu the index of the Neuron.
+	 * @param now
+	 * @return whether or not the Neuron had work to do.
+	 */
+	bool Process(
+		::std::size_t neu,
+		Timestamp now
+	);
+
+	/**
+	 * Queue the given Neuron to be Processed when its persistence window closes, if it isn't already queued for earlier. <br />
+	 * Does nothing unless *this IsEventDriven(). <br />
+	 * @param neu the index of the Neuron.
+	 * @param when
+	 */
+	void Schedule(
+		::std::size_t neu,
+		Timestamp when
+	);
+
+	/**
+	 * Register the next deadline of the given Dendrite with mWheel, if it has changed. <br />
+	 * Does nothing unless *this IsEventDriven(). <br />
+	 * @param den the index of the Dendrite.
+	 * @param from deadlines before this have already been processed; see GetNextDeadline().
+	 */
+	void ScheduleDendrite(
+		::std::size_t den,
+		Timestamp from = 0
+	);
+
+	/**
+	 * Copy the values we mirror from the Dendrite at the given index and schedule its next deadline. <br />
+	 * @param den the index of the Dendrite.
+	 * @param from deadlines before this have already been processed; see GetNextDeadline().
+	 */
+	void MirrorDendrite(
+		::std::size_t den,
+		Timestamp from
+	);
+
+	/**
+	 * Schedule the next deadline of the given Neuron and each of its Dendrites. <br />
+	 * @param neu the index of the Neuron.
+	 */
+	void ScheduleNext(::std::size_t neu);
+
+	/**
+	 * Mirror everything queued by RequestMirror(). <br />
+	 */
+	void ApplyMirrorRequests();
+
+	/**
+	 * Drop all timers and, if *this IsEventDriven(), schedule every Neuron & Dendrite anew. <br />
+	 * Used whenever indices change. <br />
+	 */
+	void Reschedule();
+
+	/**
+	 * Deadlines that have already been processed won't be processed again until Mirror() reports a change. <br />
+	 * @param den the index of the Dendrite.
+	 * @param from the earliest deadline to consider; deadlines before this have already been processed.
+	 * @return the next time (no earlier than from) the given Dendrite might have something to process or sNever.
+	 */
+	Timestamp GetNextDeadline(
+		::std::size_t den,
+		Timestamp from
+	) const;
+
+	/**
+	 * A time that will never come. <br />
+	 */
+	static const Timestamp sNever;
+
+	/**
+	 * Bits for mDendriteStates. <br />
+	 */
+	static const uint8_t sReady = 1;
+	static const uint8_t sPotentiated = 2;
+
+	//START: Neurons, indexed by Neuron::mSheath.mIndex
+	::std::vector< Neuron* > mNeurons;
+	::std::vector< Milliseconds > mIntervals;
+	::std::vector< Timestamp > mLastCrests;
+	::std::vector< Timestamp > mLastActive;
+	::std::vector< Milliseconds > mPersistFor;
+	::std::vector< FiringCondition > mFiringReasons;
+	::std::vector< uint8_t > mPersisting;
+	::std::vector< uint8_t > mPersistenceLapsed;
+	::std::vector< uint8_t > mDue;
+	::std::vector< Timestamp > mNextEvents;
+
+	/**
+	 * The Dendrites of mNeurons[i] are [mDendriteOffsets[i], mDendriteOffsets[i+1]). <br />
+	 */
+	::std::vector< ::std::size_t > mDendriteOffsets;
+	//END: Neurons
+
+	//START: Dendrites, indexed by Dendrite::mSheath.mIndex
+	::std::vector< Dendrite* > mDendrites;
+	::std::vector< uint8_t > mDendriteStates;
+	::std::vector< Timestamp > mPotentiateAt;
+	::std::vector< Timestamp > mDepotentiateAt;
+	::std::vector< uint8_t > mPending;
+	::std::vector< ::std::size_t > mDendriteOwners;
+	::std::vector< Timestamp > mDendriteDeadlines;
+	//END: Dendrites
+
+	//START: Axons, indexed by Axon::mSheath.mIndex
+	/**
+	 * The Axons of mNeurons[i] are [mAxonOffsets[i], mAxonOffsets[i+1]). <br />
+	 */
+	::std::vector< ::std::size_t > mAxonOffsets;
+	::std::vector< Axon* > mAxons;
+	//END: Axons
+
+	/**
+	 * Dendrites & Axons waiting to be Grown, along with the index of their Neuron. <br />
+	 */
+	::std::vector< ::std::pair< ::std::size_t, Dendrite* > > mNewDendrites;
+	::std::vector< ::std::pair< ::std::size_t, Axon* > > mNewAxons;
+
+	/**
+	 * mNewDendrites, swapped out by Grow(); kept as a member to reuse its capacity. <br />
+	 */
+	::std::vector< ::std::pair< ::std::size_t, Dendrite* > > mGrowingDendrites;
+
+	::std::vector< cellular::Cell* > mSupported;
+
+	bool mEventDriven;
+
+	/**
+	 * Items are (den << 1) for Dendrite deadlines and (neu << 1) | 1 for Neuron persistence deadlines. <br />
+	 * Expired timers which don't match mDendriteDeadlines or mNextEvents are stale and ignored. <br />
+	 */
+	TimerWheel mWheel;
+	TimerWheel::Timers mExpired;
+	::std::vector< ::std::size_t > mArrivals;
+	::std::vector< ::std::size_t > mFired;
+
+	/**
+	 * Queued by RequestMirror(); guarded by the lock of *this. <br />
+	 * The "Applying" vectors are swapped in by ApplyMirrorRequests(), so that the queues may keep filling while they are Mirrored. <br />
+	 */
+	::std::vector< const Neuron* > mNeuronsToMirror;
+	::std::vector< const Dendrite* > mDendritesToMirror;
+	::std::vector< const Neuron* > mApplyingNeurons;
+	::std::vector< const Dendrite* > mApplyingDendrites;
+};
+
+} //neural namespace
+} //bio namespace
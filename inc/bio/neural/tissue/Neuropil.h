@@ -31,11 +31,15 @@ namespace bio {
 namespace neural {
 
 class AxonGuide;
+class Glia;
 
 /**
  * Neuropils are simply Tissues which hold Neurons & Synapses. <br />
  * They have a number of useful methods for creating and managing Neurons & Synapses. <br />
  * You are not required to use a Neuropil over a Tissue, but it is recommended. <br />
+ * <br />
+ * Large Neuropils may be Batch()ed. A Batched Neuropil CheckIn()s all of its Neurons at once through Glia, which only call into the Neurons that have work to do. <br />
+ * Sparse networks should be Batch(true)ed, which makes the Glia event driven. See Glia.h for details. <br />
  */
 class Neuropil:
 	public neural::Class< Neuropil >,
@@ -46,19 +50,64 @@ public:
 	/**
 	 * Ensure virtual methods point to Class implementations. <br />
 	 */
-	BIO_DISAMBIGUATE_ALL_CLASS_METHODS(neural, Neuropil)
+	BIO_DISAMBIGUATE_REQUIRED_CLASS_METHODS(neural, Neuropil)
+	BIO_DISAMBIGUATE_OPTIONAL_CLASS_METHODS(genetic, Neuropil)
 
-	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS(
+	BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS_WITH_COMMON_CONSTRUCTOR(
 		neural,
 		Neuropil,
 		filter::Neural()
 	)
 
 	/**
-	 *
+	 * Will Unbatch() *this. <br />
 	 */
 	virtual  ~Neuropil();
 
+	/**
+	 * Optional cellular method. <br />
+	 * @return Tissue::Crest() by default.
+	 */
+	virtual Code Crest();
+
+	/**
+	 * Optional cellular method. <br />
+	 * @return Tissue::Apoptose() by default.
+	 */
+	virtual Code Apoptose();
+
+	/**
+	 * physical::Periodic method; called every clock tick. <br />
+	 * If *this has been Batch()ed, all Neurons in *this are advanced together by mcGlia. <br />
+	 * Otherwise, each Cell is CheckIn()'d on its own, as with any other Tissue. <br />
+	 * @return whether or not *this Crested.
+	 */
+	virtual bool CheckIn();
+
+	/**
+	 * Mirror all Neurons in *this (and their Dendrites) into Glia, so that they may be advanced in one pass on each CheckIn(). <br />
+	 * While Batched, Neurons that have no Dendrites to process and whose persistence has not changed will not be called on CheckIn() at all (i.e. neither PreCrest() nor any of their components' CheckIn()s will happen). <br />
+	 * Adding or removing Cells from *this will cause *this to re-Batch itself on the next CheckIn(). <br />
+	 * Synapses made through Connect() (i.e. Neuron::ConnectTo()) are added to the Glia as they are made. <br />
+	 * However, if you change the structure of a Neuron by other means (e.g. by Add()ing a Dendrite to it directly), you must call Batch() again yourself. <br />
+	 * Calling Batch() on an already Batched Neuropil will rebuild its Glia. <br />
+	 * If eventDriven, Neurons will only be visited when something happens to them or when one of their deadlines arrives (see Glia::SetEventDriven()). Synapses will then no longer process their postsynaptic Neuron from the presynaptic Neuron's thread. <br />
+	 * @param eventDriven whether or not to queue Neurons as they change, rather than scanning all of them on each CheckIn().
+	 * @return code::Success() if all Cells could be Batched.
+	 */
+	virtual Code Batch(bool eventDriven = false);
+
+	/**
+	 * Stop Batching *this. <br />
+	 * All Cells will be CheckIn()'d individually again. <br />
+	 */
+	virtual void Unbatch();
+
+	/**
+	 * @return whether or not *this has been Batch()ed.
+	 */
+	bool IsBatched() const;
+
 	/**
 	 * Use this method to populate any member variable Protein*s. <br />
 	 * You'll want to do this to speed up your code by bypassing the dynamic execution provided by genetic::Expressor. <br />
@@ -129,6 +178,22 @@ public:
 		const Affinity* postsynapticNeuronAffinity = NULL
 	);
 
+protected:
+
+	/**
+	 * Called by all constructors. <br />
+	 */
+	void CommonConstructor();
+
+	/**
+	 * Our Glia, if we've been Batch()ed. <br />
+	 */
+	Glia* mcGlia;
+
+	/**
+	 * The Revision of our Cells when mcGlia were made. <br />
+	 */
+	chemical::Revision mBatchedRevision;
 };
 
 } //neural namespace
@@ -25,6 +25,9 @@
 #include "bio/physical/macro/Macros.h"
 #include "Attraction.h"
 
+#include <vector>
+#include <cstddef>
+
 namespace bio {
 
 /**
@@ -84,6 +87,36 @@ public:
 	 */
 	virtual bool operator==( const Wave* wave ) const;
 
+	/**
+	 * Score many Waves at once. <br />
+	 * This calls GetStrengthOfAttractionTo() on each Wave. <br />
+	 * @param waves must not contain NULL.
+	 * @param count how many waves there are.
+	 * @param strengths must have room for count Strengths; strengths[i] will be set to the Strength of Attraction to waves[i].
+	 */
+	virtual void GetStrengthsOfAttractionTo(
+		const Wave* const* waves,
+		::std::size_t count,
+		Strength* strengths
+	) const;
+
+	/**
+	 * Find the Waves *this is attracted to, using AttractionExists() (and GetStrengthOfAttractionTo(), to rank them when limited). <br />
+	 * @param waves must not contain NULL.
+	 * @param count how many waves there are.
+	 * @param selected will be set to the indices (into waves) of the selected Waves.
+	 * @param limit if not 0, only the limit strongest Waves are selected, strongest first; otherwise, all Waves above the threshold are selected, in their original order.
+	 * @param threshold how high the Affinity::Strength must be for a Wave to be selected.
+	 * @return how many Waves were selected.
+	 */
+	::std::size_t Select(
+		const Wave* const* waves,
+		::std::size_t count,
+		::std::vector< ::std::size_t >& selected,
+		::std::size_t limit = 0,
+		Strength threshold = 0
+	) const;
+
 };
 
 } //bio namespace
@@ -28,11 +28,12 @@ namespace bio {
 
 /**
  * CachedId<> extends the Cache system by making it possible to store the Perspective* from which to fetch the Id of the given Name. <br />
+ * The Id is looked up once, along with the generation of its Perspective. It is only looked up again if the Perspective is Invalidated or the GlobalCache is Flushed. <br />
  * @tparam ID_TYPE 
  */
 template < typename ID_TYPE >
 class CachedId :
-	public Cached< ID_TYPE, const Name&, ID_TYPE (physical::Perspective< ID_TYPE >::*)(const Name&) >
+	public Cached< ID_TYPE, Name, ID_TYPE (physical::Perspective< ID_TYPE >::*)(const Name&) >
 {
 public:
 
@@ -45,12 +46,13 @@ public:
 		physical::Perspective< ID_TYPE >& perspective
 	)
 		:
-		Cached< ID_TYPE, const Name&, ID_TYPE (physical::Perspective< ID_TYPE >::*)(const Name&) >(
+		Cached< ID_TYPE, Name, ID_TYPE (physical::Perspective< ID_TYPE >::*)(const Name&) >(
 			lookup,
 			0,
 			&physical::Perspective< ID_TYPE >::GetIdFromName
 		),
-		mPerspective(perspective)
+		mPerspective(perspective),
+		mPerspectiveGeneration(0)
 	{
 		Flush();
 	}
@@ -68,7 +70,23 @@ public:
 	 */
 	virtual void Flush()
 	{
-		this->mT = ((*SafelyAccess< physical::Perspective< ID_TYPE > >(&this->mPerspective))->*(this->mLookupFunction))(this->mLookup);
+		SafelyAccess< physical::Perspective< ID_TYPE > > perspective(&this->mPerspective);
+		mPerspectiveGeneration = perspective->GetGeneration();
+		this->mT = ((*perspective)->*(this->mLookupFunction))(this->mLookup);
+		this->Refresh();
+	}
+
+	/**
+	 * Look up the Id again, if it may have changed. <br />
+	 * @return the Id of the Name given to *this.
+	 */
+	operator ID_TYPE()
+	{
+		if (this->IsStale() || mPerspectiveGeneration != mPerspective.GetGeneration())
+		{
+			Flush();
+		}
+		return this->mT;
 	}
 
 	/**
@@ -89,6 +107,7 @@ public:
 
 protected:
 	physical::Perspective< ID_TYPE >& mPerspective;
+	uint32_t mPerspectiveGeneration;
 };
 
 } //bio namespace
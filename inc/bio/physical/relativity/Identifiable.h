@@ -161,46 +161,68 @@ public:
 	}
 
 	/**
+	 * With BIO_STRICT_ID_EQUALITY (the default), this is a single integer comparison. <br />
+	 * Otherwise, this is the same as IsIdVerified(). <br />
 	 * @param id
-	 * @return whether or not the id of *this matches id provided and double checks with the Perspective used by *this.
+	 * @return whether or not the id of *this matches id provided.
 	 */
 	virtual bool operator==(const Identifier id) const
 	{
-		if (!this->GetId())
+		#if BIO_STRICT_ID_EQUALITY
+		return id.mT && this->mId == id.mT;
+		#else
+		return this->IsIdVerified(id);
+		#endif
+	}
+
+	/**
+	 * With BIO_STRICT_ID_EQUALITY (the default) and BIO_MEMORY_OPTIMIZE_LEVEL < 1, this compares the stored Name of *this without going through the Perspective. <br />
+	 * Otherwise, name is converted to an Id through the Perspective used by *this, which must match the Id of *this. <br />
+	 * @param name
+	 * @return whether or not the given name matches that of *this.
+	 */
+	virtual bool operator==(const Name& name) const
+	{
+		if (!this->GetName())
 		{
+			if (!name)
+			{
+				return true;
+			}
 			return false;
 		}
-		if (this->GetId() != id.mT)
+		if (!name)
 		{
 			return false;
 		}
-		if (this->GetPerspective() && !this->IsNameInsensitive(this->GetPerspective()->GetNameFromId(id)))
+		#if BIO_STRICT_ID_EQUALITY && BIO_MEMORY_OPTIMIZE_LEVEL < 1
+		return this->mName == name;
+		#else
+		if (this->GetPerspective() && !this->IsId(this->GetPerspective()->GetIdWithoutCreation(name)))
 		{
 			return false;
 		}
 		return true;
+		#endif
 	}
 
 	/**
-	 *
-	 * @param name
-	 * @return whether or not the given name matches that of *this and double checks with the Perspective used by *this.
+	 * Compare the id of *this with that given and double check that the Name of *this matches (case insensitively) the Name the Perspective used by *this has for the id. <br />
+	 * This is slower than operator==(), as it requires a Perspective lookup & string comparison. <br />
+	 * @param id
+	 * @return whether or not the id of *this matches id provided and is consistent with the Perspective used by *this.
 	 */
-	virtual bool operator==(const Name& name) const
+	virtual bool IsIdVerified(const Identifier id) const
 	{
-		if (!this->GetName())
+		if (!this->GetId())
 		{
-			if (!name)
-			{
-				return true;
-			}
 			return false;
 		}
-		if (!name)
+		if (this->GetId() != id.mT)
 		{
 			return false;
 		}
-		if (this->GetPerspective() && !this->IsId(this->GetPerspective()->GetIdWithoutCreation(name)))
+		if (this->GetPerspective() && !this->IsNameInsensitive(this->GetPerspective()->GetNameFromId(id)))
 		{
 			return false;
 		}
@@ -29,12 +29,15 @@
 #include "bio/physical/string/Brane.h"
 #include <sstream>
 #include <cstring>
+#include <string>
 
 //@formatter:off
 #if BIO_CPP_VERSION < 11
 	#include <stdint.h>
+	#include <map>
 #else
 	#include <cstdint>
+	#include <unordered_map>
 #endif
 //@formatter:on
 
@@ -54,6 +57,10 @@ namespace physical {
  * Thus, functionally, you can think of each DIMENSION as a different library, with its source code hidden, such that only objects within that library, that DIMENSION, may inherit from each other. <br />
  * An example DIMENSION would be uint32_t, with up to 4,294,967,295 unique object names. <br />
  * <br />
+ * Names are indexed, so looking up the Id of a Name does not need to check every Brane. <br />
+ * Once given, the Id of a Name never changes. If you must change what Ids mean (e.g. when loading a save), Invalidate() *this afterward, so that anything holding onto Ids (e.g. CachedIds) will look them up again. <br />
+ * If you know which Names a process will use, you can Preload() them all at once (e.g. at startup), rather than having each be created the first time it is used. <br />
+ * <br />
  * See below for a macro for creating singleton of Perspectives. <br />
  * @tparam DIMENSION an unsigned integer (e.g. uint8_t).
  */
@@ -67,7 +74,8 @@ public:
 	 */
 	Perspective()
 		:
-		mNextId(1)
+		mNextId(1),
+		mGeneration(0)
 	{
 		mBranes = new Arrangement< Brane< DIMENSION >* >();
 	}
@@ -120,6 +128,7 @@ public:
 	 */
 	SmartIterator Find(const DIMENSION& id)
 	{
+		mIndexLock.LockThread();
 		SmartIterator brn = mBranes->Begin();
 		for (
 			; !brn.IsAfterEnd();
@@ -128,9 +137,11 @@ public:
 		{
 			if (brn.As< Brane< DIMENSION >* >()->mId == id)
 			{
+				mIndexLock.UnlockThread();
 				return brn;
 			}
 		}
+		mIndexLock.UnlockThread();
 		brn.Invalidate();
 		return brn;
 	}
@@ -142,6 +153,7 @@ public:
 	 */
 	SmartIterator Find(const DIMENSION& id) const
 	{
+		mIndexLock.LockThread();
 		SmartIterator brn = mBranes->Begin();
 		for (
 			; !brn.IsAfterEnd();
@@ -150,9 +162,11 @@ public:
 		{
 			if (brn.As< Brane< DIMENSION >* >()->mId == id)
 			{
+				mIndexLock.UnlockThread();
 				return brn;
 			}
 		}
+		mIndexLock.UnlockThread();
 		brn.Invalidate();
 		return brn;
 	}
@@ -176,9 +190,44 @@ public:
 			return ret;
 		}
 
-		ret = mNextId++;
-		mBranes->Add(CreateBrane(ret, name));
+		return AddBrane(name);
+	}
 
+	/**
+	 * Create Ids for all of the given Names at once, in order. <br />
+	 * Empty Names and Names which already have an Id are skipped, so a new Perspective given the same Names in the same order will always produce the same Ids. <br />
+	 * This is meant to be used with a table of well-known Names (e.g. all States, Properties, Codes, etc.) when starting a process, so that they don't need to be created one at a time as each is first used. <br />
+	 * @tparam NAME anything a Name can be constructed from (e.g. const char* or ::std::string).
+	 * @param names
+	 * @param count the number of names.
+	 * @return the number of new Ids created.
+	 */
+	template < typename NAME >
+	DIMENSION Preload(
+		const NAME* names,
+		::std::size_t count
+	)
+	{
+		DIMENSION ret = 0;
+		#if BIO_CPP_VERSION >= 11
+		mIndexLock.LockThread();
+		mNameIndex.reserve(mNameIndex.size() + count);
+		mIndexLock.UnlockThread();
+		#endif
+		for (
+			::std::size_t nam = 0;
+			nam < count;
+			++nam
+			)
+		{
+			Name name(names[nam]);
+			if (!name || !name.Length() || name == InvalidName() || GetIdWithoutCreation(name))
+			{
+				continue;
+			}
+			AddBrane(name);
+			++ret;
+		}
 		return ret;
 	}
 
@@ -244,26 +293,20 @@ public:
 	 */
 	virtual DIMENSION GetIdWithoutCreation(const Name& name) const
 	{
-		if (name == InvalidName())
+		if (!name || name == InvalidName())
 		{
 			return InvalidId();
 		}
 
-		Brane< DIMENSION >* brane;
-		SmartIterator brn = mBranes->Begin();
-		for (
-			; !brn.IsAfterEnd();
-			++brn
-			)
+		DIMENSION ret = InvalidId();
+		mIndexLock.LockThread();
+		typename NameIndex::const_iterator found = mNameIndex.find(name.AsStdString());
+		if (found != mNameIndex.end())
 		{
-			brane = brn;
-
-			if (name == brane->mName)
-			{
-				return brane->mId;
-			}
+			ret = found->second;
 		}
-		return InvalidId();
+		mIndexLock.UnlockThread();
+		return ret;
 	}
 
 	/**
@@ -274,9 +317,63 @@ public:
 		return this->mNextId - 1;
 	}
 
+	/**
+	 * Tell everything which has looked up Ids in *this to look them up again. <br />
+	 */
+	void Invalidate()
+	{
+		++mGeneration;
+	}
+
+	/**
+	 * @return the number of times *this has been Invalidated.
+	 */
+	uint32_t GetGeneration() const
+	{
+		return mGeneration;
+	}
+
 
 protected:
 
+	/**
+	 * Name -> Id, for every named Brane in *this. <br />
+	 */
+	#if BIO_CPP_VERSION >= 11
+	typedef ::std::unordered_map< ::std::string, DIMENSION > NameIndex;
+	#else
+	typedef ::std::map< ::std::string, DIMENSION > NameIndex;
+	#endif
+
+	/**
+	 * Create a Brane for the given Name with the next Id and index it. <br />
+	 * Callers should check that the Name does not have an Id first; however, if another thread gave the Name an Id in the meantime, that Id is returned instead. <br />
+	 * @param name
+	 * @return the Id of the Name.
+	 */
+	DIMENSION AddBrane(const Name& name)
+	{
+		mIndexLock.LockThread();
+		if (name)
+		{
+			typename NameIndex::const_iterator found = mNameIndex.find(name.AsStdString());
+			if (found != mNameIndex.end())
+			{
+				DIMENSION existing = found->second;
+				mIndexLock.UnlockThread();
+				return existing;
+			}
+		}
+		DIMENSION ret = mNextId++;
+		mBranes->Add(CreateBrane(ret, name));
+		if (name)
+		{
+			mNameIndex.insert(typename NameIndex::value_type(name.AsStdString(), ret));
+		}
+		mIndexLock.UnlockThread();
+		return ret;
+	}
+
 	/**
 	 * Instead of making Brane a template parameter to *this, we provide this virtual Create method to allow for the creation of custom Branes. <br />
 	 * @param id
@@ -324,6 +421,14 @@ protected:
 
 	mutable Container* mBranes;
 	DIMENSION mNextId;
+	NameIndex mNameIndex;
+	uint32_t mGeneration;
+
+	/**
+	 * Guards mBranes, mNextId, & mNameIndex (and the types of TypedBranes). <br />
+	 * This is separate from the lock of *this, so that Names may be looked up by those which don't (or can't) SafelyAccess *this, e.g. while a type is being created. <br />
+	 */
+	ThreadSafe mIndexLock;
 };
 
 } //physical namespace
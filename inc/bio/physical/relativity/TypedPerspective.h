@@ -33,6 +33,8 @@ namespace physical {
 /**
  * A TypedPerspective extends Perspective by adding Wave*s to its Branes. <br />
  * This allows you to (Dis)AssociateType(...) and GetNewObject...(...) from Names and Ids. <br />
+ * <br />
+ * Constructing every type when it is Associated can make starting a process slow. If you DeferTypes(), types may instead be Associated with a function that creates them (see AssociateTypeCreator()), and each will only be created when it is first used. <br />
  * @tparam DIMENSION an unsigned integer (e.g. uint8_t).
  */
 template < typename DIMENSION >
@@ -44,6 +46,9 @@ public:
 	 *
 	 */
 	TypedPerspective()
+		:
+		mDeferTypes(false),
+		mTypeGeneration(0)
 	{
 
 	}
@@ -79,10 +84,59 @@ public:
 		TypedBrane< DIMENSION >* brane = this->template GetBraneAs< TypedBrane< DIMENSION >* >(id);
 		BIO_SANITIZE(brane, , return false)
 		// BIO_SANITIZE_AT_SAFETY_LEVEL_1(brane->mType, , return false) //it's okay if mType is NULL
+		this->mIndexLock.LockThread();
 		brane->mType = type;
+		++mTypeGeneration;
+		this->mIndexLock.UnlockThread();
 		return true;
 	}
 
+	/**
+	 * Associates a function which creates the type for the given id. <br />
+	 * The function will be called (and the type it returns Associated) the first time the type is requested (e.g. by GetTypeFromId()). <br />
+	 * Nop if a type is already Associated. <br />
+	 * The same rules as AssociateType() apply to the Wave created. <br />
+	 * @param id
+	 * @param createType
+	 * @return true if the association completed successfully else false
+	 */
+	virtual bool AssociateTypeCreator(
+		const DIMENSION& id,
+		Wave* (*createType)()
+	)
+	{
+		BIO_SANITIZE(createType, , return false)
+		TypedBrane< DIMENSION >* brane = this->template GetBraneAs< TypedBrane< DIMENSION >* >(id);
+		BIO_SANITIZE(brane, , return false)
+		this->mIndexLock.LockThread();
+		if (!brane->mType)
+		{
+			brane->mCreateType = createType;
+			++mTypeGeneration;
+		}
+		this->mIndexLock.UnlockThread();
+		return true;
+	}
+
+	/**
+	 * Set whether or not types should be created as soon as they are known or when they are first used. <br />
+	 * This should be set before any types are Associated (i.e. at the start of your program). <br />
+	 * NOTE: *this does not create types itself; it is up to whoever Associates types to check IsDeferringTypes() (see chemical::Elementary). <br />
+	 * @param defer
+	 */
+	void DeferTypes(bool defer = true)
+	{
+		mDeferTypes = defer;
+	}
+
+	/**
+	 * @return whether or not types should be created when they are first used, rather than when they are Associated.
+	 */
+	bool IsDeferringTypes() const
+	{
+		return mDeferTypes;
+	}
+
 	/**
 	 * Removes the type association created by AssociateType() and deletes the Associated Wave. <br />
 	 * Disassociating a type has no effect on the Recorded Properties. <br />
@@ -93,24 +147,76 @@ public:
 	{
 		TypedBrane< DIMENSION >* brane = this->template GetBraneAs< TypedBrane< DIMENSION >* >(id);
 		BIO_SANITIZE(brane, , return false)
-		if (brane->mType)
+		this->mIndexLock.LockThread();
+		Wave* type = brane->mType;
+		brane->mType = NULL;
+		brane->mCreateType = NULL;
+		++mTypeGeneration;
+		this->mIndexLock.UnlockThread();
+		if (type)
 		{
-			delete brane->mType;
-			brane->mType = NULL;
+			delete type;
 		}
 		return true;
 	}
 
 	/**
-	 * Only works if AssociateType has been called with the given id. <br />
+	 * @return how many times a type has been (Dis)Associated with *this; use this to tell when anything derived from the types of *this must be found again.
+	 */
+	uint32_t GetTypeGeneration() const
+	{
+		return mTypeGeneration;
+	}
+
+	/**
+	 * Only works if AssociateType or AssociateTypeCreator has been called with the given id. <br />
+	 * If the type has not been created yet, it will be created now, exactly once. Threads which ask for the type while it is being created will wait for it. <br />
+	 * The type is created without holding any lock of *this, since constructing it will usually use *this. Thus, do not call this while SafelyAccessing *this. <br />
 	 * @param id
-	 * @return the pointer to the Wave type associated with the given id else NULL.
+	 * @return the pointer to the Wave type associated with the given id else NULL (including while the type is being created by the calling thread, i.e. if the type looks itself up while being constructed).
 	 */
 	virtual const Wave* GetTypeFromId(const DIMENSION& id) const
 	{
 		TypedBrane< DIMENSION >* brane = this->template GetBraneAs< TypedBrane< DIMENSION >* >(id);
 		BIO_SANITIZE(brane, , return NULL)
-		return brane->mType;
+
+		this->mIndexLock.LockThread();
+		while (!brane->mType && brane->mCreating)
+		{
+			if (brane->mCreator == Threaded::GetCurrentThreadId())
+			{
+				this->mIndexLock.UnlockThread();
+				return NULL;
+			}
+			this->mIndexLock.UnlockThread();
+			Threaded::YieldThread();
+			this->mIndexLock.LockThread();
+		}
+		Wave* type = brane->mType;
+		Wave* (*createType)() = type ? NULL : brane->mCreateType;
+		if (createType)
+		{
+			brane->mCreating = true;
+			brane->mCreator = Threaded::GetCurrentThreadId();
+		}
+		this->mIndexLock.UnlockThread();
+
+		if (!createType)
+		{
+			return type;
+		}
+		type = createType();
+
+		this->mIndexLock.LockThread();
+		if (type)
+		{
+			brane->mType = type;
+			brane->mCreateType = NULL;
+		}
+		brane->mCreating = false;
+		brane->mCreator = Threaded::InvalidThreadId();
+		this->mIndexLock.UnlockThread();
+		return type;
 	}
 
 	/**
@@ -223,6 +329,9 @@ protected:
 	{
 		return new TypedBrane< DIMENSION >(id, name, NULL);
 	}
+
+	bool mDeferTypes;
+	uint32_t mTypeGeneration;
 };
 
 } //physical namespace
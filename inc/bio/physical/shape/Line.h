@@ -24,11 +24,20 @@
 #include "Linear.h"
 #include "bio/common/container/Arrangement.h"
 
+#if BIO_CPP_VERSION >= 11
+	#include <unordered_map>
+#else
+	#include <map>
+#endif
+
 namespace bio {
 namespace physical {
 
 /**
  * Lines are Linear Arrangements. <br />
+ * Lines keep an index of the Ids of their contents, so that seeking by Id or Name does not need to check every element. <br />
+ * The index is updated as contents are Added and rebuilt on first use after contents are Inserted or Erased. <br />
+ * NOTE: if the Id of something already in a Line changes, that Line will only find it by its new Id once the Line is changed again. <br />
  *
  * NOTE: We reserve Position 0 as invalid. <br />
  *
@@ -58,7 +67,9 @@ public:
 	virtual ~Line();
 
 	/**
-	 * Get the position of an Identifiable< Id >* with the given name in *this.
+	 * Get the position of an Identifiable< Id >* with the given name in *this. <br />
+	 * The name is converted to an Id once, through the Perspective of the contents of *this, and then sought by Id. <br />
+	 * If that lookup misses (e.g. contents use another Perspective or were renamed), every element's Name is compared instead. <br />
 	 * @param name
 	 * @return an Index matching the given name or InvalidIndex().
 	 */
@@ -71,6 +82,36 @@ public:
 	 */
 	virtual Index SeekToId(const Id& id) const;
 
+	/**
+	 * Adds content to *this & indexes its Id. <br />
+	 * @param content
+	 * @return the Index of the added content.
+	 */
+	virtual Index Add(const ByteStream content);
+
+	/**
+	 * Inserting moves contents, so the Id index of *this will be rebuilt on next use. <br />
+	 * @param content
+	 * @param index
+	 * @return the Index of the added content.
+	 */
+	virtual Index Insert(
+		const ByteStream content,
+		const Index index
+	);
+
+	/**
+	 * Removes content from *this & its Id from the index of *this. <br />
+	 * @param index
+	 * @return the content that was previously at the given index.
+	 */
+	virtual ByteStream Erase(Index index);
+
+	/**
+	 * Remove all elements & Ids from *this. <br />
+	 */
+	virtual void Clear();
+
 	/**
 	 * Since we operate on Identifiable< Id >*, not Linears, we want to treat the external datum as Identifiable< Id >*. <br />
 	 * @param internal
@@ -96,8 +137,50 @@ public:
 	 */
 	virtual const Identifiable< Id >* LinearAccess(Index index) const;
 
+	/**
+	 * Contents which change their Id while in *this (e.g. when Restored from a Snapshot) are not reindexed automatically. <br />
+	 * Call this after changing them to rebuild the Id index on the next Seek. <br />
+	 */
+	void InvalidateIdIndex();
+
 protected:
+
+	/**
+	 * Index the Ids of all contents of *this, if they are not already. <br />
+	 */
+	void IndexIds() const;
+
+	/**
+	 * Compare the Name of every element of *this; used when the Id lookup cannot find name. <br />
+	 * @param name
+	 * @return an Index matching the given name or InvalidIndex().
+	 */
+	Index ScanForName(const Name& name) const;
+
 	mutable Iterator* mTempItt;
+
+	/**
+	 * Hashes Ids by their value. <br />
+	 */
+	struct IdHash
+	{
+		::std::size_t operator()(const Id& id) const
+		{
+			return id.mT;
+		}
+	};
+
+	/**
+	 * Id -> the last Index with that Id. <br />
+	 */
+	#if BIO_CPP_VERSION >= 11
+	typedef ::std::unordered_map< Id, Index, IdHash > IdIndex;
+	#else
+	typedef ::std::map< Id, Index > IdIndex;
+	#endif
+
+	mutable IdIndex mIdIndex;
+	mutable bool mIdIndexIsStale;
 };
 
 } //physical namespace
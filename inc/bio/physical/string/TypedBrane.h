@@ -22,6 +22,7 @@
 #pragma once
 
 #include "Brane.h"
+#include "bio/common/thread/Threaded.h"
 
 namespace bio {
 namespace physical {
@@ -30,6 +31,7 @@ class Wave;
 
 /**
  * Adds a Wave* type to Perspective< DIMENSION >::Brane. <br />
+ * Instead of a type, a TypedBrane may hold a function which creates the type, so that the type is not constructed until it is first needed (see TypedPerspective::DeferTypes()). <br />
  * @tparam DIMENSION
  */
 template< typename DIMENSION >
@@ -43,7 +45,10 @@ public:
 	)
 		:
 		Brane< DIMENSION >(id, name),
-		mType(type)
+		mType(type),
+		mCreateType(NULL),
+		mCreating(false),
+		mCreator(Threaded::InvalidThreadId())
 	{
 	}
 
@@ -57,6 +62,13 @@ public:
 	}
 
 	Wave* mType;
+	Wave* (*mCreateType)();
+
+	/**
+	 * Whether or not mCreateType is being called and by which thread. <br />
+	 */
+	bool mCreating;
+	Threaded::ThreadId mCreator;
 };
 
 } //physical namespace
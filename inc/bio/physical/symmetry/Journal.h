@@ -0,0 +1,62 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2023 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace bio {
+namespace physical {
+
+class Symmetry;
+
+/**
+ * A Journal is told whenever a Symmetry it is Set on changes or goes away. <br />
+ * This lets something like a Checkpoint find what has changed without looking at everything. <br />
+ * A Symmetry has at most 1 Journal. <br />
+ */
+class Journal
+{
+public:
+	/**
+	 *
+	 */
+	Journal();
+
+	/**
+	 *
+	 */
+	virtual ~Journal();
+
+	/**
+	 * Called when the given Symmetry is written to (see Symmetry::SetValue() and Symmetry::AccessValue()). <br />
+	 * This may be called from any thread. <br />
+	 * @param changed
+	 */
+	virtual void Note(Symmetry* changed) = 0;
+
+	/**
+	 * Called when the given Symmetry is destroyed. <br />
+	 * @param gone
+	 */
+	virtual void Forget(Symmetry* gone) = 0;
+};
+
+} //physical namespace
+} //bio namespace
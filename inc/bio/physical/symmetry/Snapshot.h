@@ -0,0 +1,375 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2023 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Symmetry.h"
+#include "bio/physical/relativity/Perspective.h"
+#include "bio/physical/common/Codes.h"
+
+#include <vector>
+#include <string>
+
+namespace bio {
+namespace physical {
+
+/**
+ * A Snapshot is a compact, binary record of a tree of Symmetries. <br />
+ * Each Symmetry is Recorded with the index of its parent and a Link describing how its parent held it, so the shape of the tree that was Spun can be recovered. <br />
+ * Perspectives may also be Recorded as tables, so that the Ids used when the Snapshot was taken can be restored before anything else. <br />
+ * <br />
+ * Snapshots are Written as: <br />
+ * a header (magic, Version(), number of tables, number of records), <br />
+ * then each table, then each record, all prefixed with their length in bytes. <br />
+ * All numbers are stored in the native byte order of the machine that Wrote them. <br />
+ * <br />
+ * Reading a Snapshot maps the file into memory (where possible) and parses the records in place: the mapping is kept until *this is Cleared, rather than copied. <br />
+ * All of the Symmetries Read are allocated in one block. <br />
+ * NOTE: Symmetry values are stored as raw bytes. Values which hold pointers will not be meaningful when Read by another process. <br />
+ * <br />
+ * See chemical::Snapshot for Capturing and Restoring whole objects. <br />
+ */
+class Snapshot
+{
+public:
+
+	/**
+	 * Increment this whenever the file layout changes. <br />
+	 * @return the version of the file format Written by *this.
+	 */
+	static uint32_t Version();
+
+	/**
+	 * @return the parent of records which have no parent.
+	 */
+	static Index NoParent();
+
+	/**
+	 * How a record was held by its parent. <br />
+	 * These are only numbers here; see chemical::Snapshot for what they mean there. <br />
+	 */
+	struct Link
+	{
+		Link(
+			uint32_t kind = 0,
+			uint32_t id = 0,
+			uint32_t type = 0,
+			uint32_t ofClass = 0
+		);
+
+		uint32_t mKind; //e.g. whether the record was Bonded or a Motif Content.
+		uint32_t mId; //e.g. the AtomicNumber of a Bond.
+		uint32_t mType; //e.g. the BondType of a Bond.
+		uint32_t mClass; //e.g. the AtomicNumber of what was Recorded, so that it can be created again.
+	};
+
+	/**
+	 *
+	 */
+	Snapshot();
+
+	/**
+	 *
+	 */
+	virtual ~Snapshot();
+
+	/**
+	 * Remove all records and tables from *this. <br />
+	 */
+	virtual void Clear();
+
+	/**
+	 * Append a record to *this. <br />
+	 * @param symmetry may be NULL, if the Recorded object has no Symmetry.
+	 * @param parent the index of the parent record or NoParent().
+	 * @param id the Id of the Recorded object, if it has one.
+	 * @param name the Name of the Recorded object, if it has one.
+	 * @param link how the Recorded object was held by its parent.
+	 * @return the index of the new record.
+	 */
+	Index Record(
+		const Symmetry* symmetry,
+		Index parent = NoParent(),
+		Id id = 0,
+		const Name& name = NULL,
+		const Link& link = Link());
+
+	/**
+	 * Append the Names of all Ids in the given Perspective to *this. <br />
+	 * @tparam DIMENSION
+	 * @param table the name under which the Perspective is stored.
+	 * @param perspective
+	 */
+	template < typename DIMENSION >
+	void RecordPerspective(
+		const Name& table,
+		const Perspective< DIMENSION >& perspective
+	)
+	{
+		Table recorded;
+		recorded.mName = table.AsStdString();
+		DIMENSION numIds = perspective.GetNumUsedIds();
+		recorded.mNames.reserve(numIds);
+		for (
+			::std::size_t id = 1;
+			id <= numIds;
+			++id
+			)
+		{
+			Name name = perspective.GetNameFromId(DIMENSION(id));
+			recorded.mNames.push_back(name ? name.AsStdString() : ::std::string());
+		}
+		mTables.push_back(recorded);
+	}
+
+	/**
+	 * Register each Name from the given table with the given Perspective, in the order they were Recorded. <br />
+	 * If the Perspective is new, this recreates the Ids exactly. Otherwise, remap is filled with the Id each Recorded Id now has. <br />
+	 * @tparam DIMENSION
+	 * @param table the name the Perspective was Recorded with.
+	 * @param perspective
+	 * @param remap optional; remap[recordedId] will be the current Id for the same Name.
+	 * @return code::Success(), if all Ids were recreated exactly; code::SuccessfullyReplaced(), if some Ids must be remapped; or code::CouldNotFindValue1(), if the table does not exist.
+	 */
+	template < typename DIMENSION >
+	Code RestorePerspective(
+		const Name& table,
+		Perspective< DIMENSION >& perspective,
+		::std::vector< DIMENSION >* remap = NULL
+	) const
+	{
+		const Table* found = GetTable(table);
+		if (!found)
+		{
+			return code::CouldNotFindValue1();
+		}
+		//Create every Id at once, then check which moved.
+		perspective.Preload(
+			found->mNames.empty() ? NULL : &found->mNames[0],
+			found->mNames.size());
+
+		Code ret = code::Success();
+		if (remap)
+		{
+			remap->assign(found->mNames.size() + 1, Perspective< DIMENSION >::InvalidId());
+		}
+		for (
+			::std::size_t nam = 0;
+			nam < found->mNames.size();
+			++nam
+			)
+		{
+			if (found->mNames[nam].empty())
+			{
+				continue;
+			}
+			DIMENSION current = perspective.GetIdWithoutCreation(found->mNames[nam]);
+			if (remap)
+			{
+				(*remap)[nam + 1] = current;
+			}
+			if (current != DIMENSION(nam + 1))
+			{
+				ret = code::SuccessfullyReplaced();
+			}
+		}
+		return ret;
+	}
+
+	/**
+	 * Encode *this exactly as it would be Written. <br />
+	 * @param out the bytes of *this are appended here.
+	 */
+	void Encode(::std::vector< char >& out) const;
+
+	/**
+	 * Write *this to the given file. <br />
+	 * @param path
+	 * @return code::Success() or code::GeneralFailure(), if the file could not be written.
+	 */
+	Code Write(const char* path) const;
+
+	/**
+	 * Replace the contents of *this with what is stored in the given file. <br />
+	 * Where possible, the file is mapped into memory and parsed in place; the mapping is kept until *this is Cleared (or Read / Loaded again). <br />
+	 * @param path
+	 * @return code::Success(); code::CouldNotFindValue1(), if the file could not be opened; or code::BadArgument1(), if the file is not a valid Snapshot.
+	 */
+	Code Read(const char* path);
+
+	/**
+	 * Replace the contents of *this with what is stored in the given bytes (e.g. a Snapshot which was Written and then mapped into memory). <br />
+	 * The records are copied once, so the given bytes need not outlive *this. <br />
+	 * @param bytes
+	 * @param size
+	 * @return code::Success() or code::BadArgument1(), if the bytes are not a valid Snapshot.
+	 */
+	Code Load(
+		const char* bytes,
+		::std::size_t size
+	);
+
+	/**
+	 * @return the number of records in *this.
+	 */
+	Index GetNumberOfRecords() const;
+
+	/**
+	 * @param record
+	 * @return the index of the parent of the given record or NoParent().
+	 */
+	Index GetParent(Index record) const;
+
+	/**
+	 * @param record
+	 * @return the Id of the object the given record was taken from or 0.
+	 */
+	Id GetId(Index record) const;
+
+	/**
+	 * @param record
+	 * @return the Name of the object the given record was taken from or NULL.
+	 */
+	Name GetName(Index record) const;
+
+	/**
+	 * Only available after *this has been Read or Loaded. <br />
+	 * @param record
+	 * @return the Symmetry of the given record or NULL.
+	 */
+	const Symmetry* GetSymmetry(Index record) const;
+
+	/**
+	 * @param record
+	 * @return how the given record was held by its parent.
+	 */
+	Link GetLink(Index record) const;
+
+	/**
+	 * This is the type of the Recorded object for any chemical::Class. <br />
+	 * @param record
+	 * @return the Name of the Symmetry of the given record or NULL.
+	 */
+	Name GetSymmetryName(Index record) const;
+
+protected:
+
+	struct Table
+	{
+		::std::string mName;
+		::std::vector< ::std::string > mNames; //Id i is at i-1.
+	};
+
+	/**
+	 * Strings are not copied out of the records; each is kept as its position & size within GetRecords(). <br />
+	 */
+	struct Entry
+	{
+		Index mParent;
+		Id mId;
+		Link mLink;
+		uint32_t mName;
+		uint32_t mNameSize;
+		uint32_t mSymmetryName;
+		uint32_t mSymmetryNameSize;
+		Index mSymmetry; //into mSymmetries; NoParent() if there is none.
+	};
+
+	/**
+	 * Snapshots own their Symmetries, so they cannot be copied. <br />
+	 */
+	Snapshot(const Snapshot& toCopy);
+	void operator=(const Snapshot& toCopy);
+
+	/**
+	 * @param table
+	 * @return the Table with the given name or NULL.
+	 */
+	const Table* GetTable(const Name& table) const;
+
+	/**
+	 * Parse the given bytes into *this. <br />
+	 * @param bytes
+	 * @param size
+	 * @param inPlace whether the given bytes will outlive *this (e.g. a mapped file), so that the records need not be copied.
+	 * @return code::Success() or code::BadArgument1(), if the bytes are not a valid Snapshot.
+	 */
+	Code Parse(
+		const char* bytes,
+		::std::size_t size,
+		bool inPlace
+	);
+
+	/**
+	 * @return the encoded records of *this, wherever they are.
+	 */
+	const char* GetRecords() const;
+
+	/**
+	 * @return the size of GetRecords().
+	 */
+	::std::size_t GetSizeOfRecords() const;
+
+	/**
+	 * @param at
+	 * @param size
+	 * @return the string at the given position in GetRecords() or NULL, if it is empty.
+	 */
+	Name GetString(
+		uint32_t at,
+		uint32_t size
+	) const;
+
+	/**
+	 * Copy records parsed in place into mRecords, so that more may be Recorded. <br />
+	 */
+	void OwnRecords();
+
+	::std::vector< Table > mTables;
+	::std::vector< Entry > mEntries;
+
+	/**
+	 * Encoded Symmetries, as they will be Written. <br />
+	 * Each Recorded Symmetry is encoded once, rather than copied. <br />
+	 */
+	::std::vector< char > mRecords;
+
+	/**
+	 * Records which were parsed in place (e.g. from mMapping) rather than copied into mRecords. <br />
+	 */
+	const char* mInPlace;
+	::std::size_t mInPlaceSize;
+
+	/**
+	 * What Read() mapped or, where files cannot be mapped, read. <br />
+	 */
+	void* mMapping;
+	::std::size_t mMappingSize;
+	::std::vector< char > mFile;
+
+	/**
+	 * Read Symmetries are allocated together. <br />
+	 */
+	Symmetry* mSymmetries;
+};
+
+} //physical namespace
+} //bio namespace
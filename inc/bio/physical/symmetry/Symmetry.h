@@ -23,6 +23,7 @@
 
 #include "bio/physical/common/Types.h"
 #include "bio/physical/relativity/Identifiable.h"
+#include "bio/physical/symmetry/Journal.h"
 #include "bio/common/ByteStream.h"
 
 namespace bio {
@@ -87,7 +88,20 @@ public:
 	);
 
 	/**
-	 *
+	 * The copy does not share the Journal of toCopy. <br />
+	 * @param toCopy
+	 */
+	Symmetry(const Symmetry& toCopy);
+
+	/**
+	 * Copies everything but the Journal of toCopy; *this keeps its own Journal and tells it about the change. <br />
+	 * @param toCopy
+	 * @return *this
+	 */
+	Symmetry& operator=(const Symmetry& toCopy);
+
+	/**
+	 * Tells our Journal, if any, that *this is gone. <br />
 	 */
 	virtual ~Symmetry();
 
@@ -111,7 +125,7 @@ public:
 
 	/**
 	 * Set the mValue of *this. <br />
-	 * Also sets the TimeUpdated. <br />
+	 * Also sets the TimeUpdated and tells our Journal. <br />
 	 * @param bytes
 	 */
 	virtual void SetValue(const ByteStream& bytes);
@@ -124,7 +138,7 @@ public:
 
 	/**
 	 * Get the mValue of *this for direct editing. <br />
-	 * Also sets the TimeUpdated. <br />
+	 * Also sets the TimeUpdated and tells our Journal. <br />
 	 * @return mValue for writing.
 	 */
 	virtual ByteStream* AccessValue();
@@ -152,12 +166,24 @@ public:
 	 */
 	virtual void Realize();
 
+	/**
+	 * Set what to tell when *this changes or is destroyed. <br />
+	 * @param journal may be NULL.
+	 */
+	virtual void SetJournal(Journal* journal);
+
+	/**
+	 * @return the Journal of *this or NULL.
+	 */
+	virtual Journal* GetJournal() const;
+
 protected:
 	ByteStream mValue;
 	Identifiable< SymmetryType > mType;
 	Timestamp mTimeCreated;
 	Timestamp mTimeUpdated;
 	Wave* mRealization;
+	Journal* mJournal;
 };
 
 } //physical namespace
@@ -25,6 +25,9 @@
 #include "bio/physical/common/Superpositions.h"
 #include "bio/physical/shape/Line.h"
 
+#include <map>
+#include <vector>
+
 namespace bio {
 namespace physical {
 
@@ -37,6 +40,9 @@ class SuperSymmetry;
  * To accommodate Waves of arbitrary complexity (i.e. the number of Wave components), Interference can be recursive. <br />
  * When accessing the Superposition of a given Symmetry, the Wave Superposing others may choose to also access the sub-interference for that Symmetry. This is done on a case-by-case basis, according to the implementation of Superpose. <br />
  * Here, Symmetries can be thought of as Wave components. <br />
+ * <br />
+ * Symmetry Ids are small and given in order, so *this keeps a table from each Symmetry Id straight to its SuperSymmetry (i.e. its Superposition and child Interference), rather than seeking through mSuperSymmetries on every lookup. Ids too large for the table are kept in a small map instead. <br />
+ * Because of this, SuperSymmetries should only be added to *this through the Set...For() methods. <br />
  */
 class Interference:
 	public physical::Class< Interference >
@@ -81,6 +87,17 @@ public:
      */
     virtual void SetInterferenceFor(const Id& symmetry, Interference* interference);
 
+    /**
+     * Get the Superposition for the Symmetry of each of the given Waves, in order. <br />
+     * Each distinct Symmetry is only looked up once. <br />
+     * @param waves
+     * @param superpositions what to fill; cleared first.
+     */
+    virtual void GetSuperpositionsFor(
+        const ConstWaves& waves,
+        ::std::vector< Superposition >& superpositions
+    ) const;
+
 protected:
 	virtual const SuperSymmetry* GetSuperSymmetryFor(const Id& symmetry) const;
 	virtual SuperSymmetry* GetSuperSymmetryFor(const Id& symmetry);
@@ -89,6 +106,28 @@ protected:
      * Internal map of Symmetry Id to Superposition pairs, plus whatever else SuperSymmetry provides. <br />
      */
     mutable Line mSuperSymmetries;
+
+	/**
+	 * Add the given SuperSymmetry to *this. <br />
+	 * @param superSymmetry
+	 */
+	void AddSuperSymmetry(SuperSymmetry* superSymmetry);
+
+	/**
+	 * How many Symmetry Ids mDenseSuperSymmetries may hold. <br />
+	 */
+	static const Index sMaxDenseSize = 4096;
+
+	/**
+	 * Symmetry Id -> SuperSymmetry, for Ids below sMaxDenseSize; NULL where there is none. <br />
+	 * The SuperSymmetries are shared with mSuperSymmetries (and with any copies of *this). <br />
+	 */
+	::std::vector< SuperSymmetry* > mDenseSuperSymmetries;
+
+	/**
+	 * Symmetry Id -> SuperSymmetry, for all other Ids. <br />
+	 */
+	::std::map< Id, SuperSymmetry* > mSparseSuperSymmetries;
 };
 
 } // namespace physical
@@ -30,6 +30,8 @@
 #include "Collapse.h"
 #include "Interference.h"
 
+#include <cstring>
+
 namespace bio {
 namespace physical {
 
@@ -172,7 +174,15 @@ public:
 	 */
 	virtual const Symmetry* Spin() const
 	{
-		this->mSymmetry->AccessValue()->Set(*this->mQuantized);
+		//Only write (and so update the TimeUpdated of mSymmetry) if our value has changed.
+		const ByteStream& value = this->mSymmetry->GetValue();
+		if (!value.Is< T >() || ::std::memcmp(
+			&value.As< T >(),
+			this->mQuantized,
+			sizeof(T)) != 0)
+		{
+			this->mSymmetry->AccessValue()->Set(*this->mQuantized);
+		}
 		return this->Wave::Spin();
 	}
 
@@ -181,10 +191,14 @@ public:
 	 * Reconstruct *this from the given Symmetry. <br />
 	 * @param symmetry
 	 */
-	virtual Code Refiy(const Symmetry* symmetry)
+	virtual Code Reify(const Symmetry* symmetry)
 	{
 		BIO_SANITIZE(symmetry, ,
 			return code::BadArgument1());
+		if (!symmetry->GetValue().Is< T >())
+		{
+			return code::BadArgument1();
+		}
 		//Wave::Reify(symmetry); //this does nothing useful.
 		*this->mQuantized = symmetry->GetValue().As< T >();
 		return code::Success();
@@ -176,6 +176,8 @@ public:
 	/**
 	 * Ease of use method to create a Superposition of many Waves. <br />
 	 * Only *this may be modified. <br />
+	 * The Superposition of each Symmetry is looked up once for the whole batch so that Noninterfering Waves can be skipped without calling Superpose() on them (as is everything, if *this is Noninterfering). <br />
+	 * Every other Wave is handed to the Superpose() above, so overriding that is enough to change how batches are Superposed. <br />
 	 * @param displacement
 	 * @param pattern
 	 * @return *this.
@@ -56,11 +56,16 @@ Code Cell::ExpressGenes()
 
 bool Cell::IsWithinTissue(const Id& tissueId) const
 {
-	if (!GetEnvironment< Tissue* >())
+	const Tissue* tissue = GetEnvironment< Tissue* >();
+	if (!tissue)
 	{
 		return false;
 	}
-	return GetEnvironment< Tissue* >()->IsWithinTissue(tissueId);
+	if (tissue->GetId() == tissueId)
+	{
+		return true;
+	}
+	return tissue->IsWithinTissue(tissueId);
 }
 
 bool Cell::IsWithinTissue(const Name& name) const
@@ -22,6 +22,8 @@
 #include "bio/cellular/Tissue.h"
 #include "bio/cellular/Cell.h"
 
+#include <algorithm>
+
 namespace bio {
 namespace cellular {
 
@@ -75,15 +77,15 @@ Code Tissue::DifferentiateCells()
 
 bool Tissue::IsWithinTissue(const Id& tissueId) const
 {
-	if (!GetEnvironment< Tissue* >())
-	{
-		return false;
-	}
-	if (GetEnvironment< Tissue* >()->GetId() == tissueId)
-	{
-		return true;
-	}
-	return GetEnvironment< Tissue* >()->IsWithinTissue(tissueId);
+	LockThread();
+	CacheAncestry();
+	bool ret = ::std::binary_search(
+		mAncestry.begin(),
+		mAncestry.end(),
+		tissueId
+	);
+	UnlockThread();
+	return ret;
 }
 
 bool Tissue::IsWithinTissue(const Name& name) const
@@ -97,5 +99,90 @@ void Tissue::SetEnvironment(Tissue* environment)
 	EnvironmentDependent< Tissue* >::SetEnvironment(environment);
 }
 
+void Tissue::EnvironmentChanged(Tissue* /*environment*/)
+{
+	InvalidateAncestry();
+}
+
+::std::vector< Id > Tissue::GetAncestry() const
+{
+	LockThread();
+	CacheAncestry();
+	::std::vector< Id > ret = mAncestry;
+	UnlockThread();
+	return ret;
+}
+
+::std::size_t Tissue::GetDepth() const
+{
+	LockThread();
+	CacheAncestry();
+	::std::size_t ret = mDepth;
+	UnlockThread();
+	return ret;
+}
+
+void Tissue::CommonConstructor()
+{
+	mDepth = 0;
+	mAncestryIsStale = true;
+}
+
+void Tissue::InvalidateAncestry()
+{
+	LockThread();
+	bool wasStale = mAncestryIsStale;
+	mAncestryIsStale = true;
+	UnlockThread();
+	if (wasStale)
+	{
+		return;
+	}
+
+	Container* tissues = GetAll< Tissue* >();
+	if (!tissues)
+	{
+		return;
+	}
+	Tissue* tissue;
+	for (
+		SmartIterator tis = tissues->Begin();
+		!tis.IsAfterEnd();
+		++tis
+		)
+	{
+		tissue = tis;
+		if (tissue)
+		{
+			tissue->InvalidateAncestry();
+		}
+	}
+}
+
+void Tissue::CacheAncestry() const
+{
+	if (!mAncestryIsStale)
+	{
+		return;
+	}
+	const Tissue* parent = GetEnvironment< Tissue* >();
+	if (parent)
+	{
+		mAncestry = parent->GetAncestry();
+		mAncestry.insert(
+			::std::upper_bound(
+				mAncestry.begin(),
+				mAncestry.end(),
+				parent->GetId()),
+			parent->GetId());
+	}
+	else
+	{
+		mAncestry.clear();
+	}
+	mDepth = mAncestry.size();
+	mAncestryIsStale = false;
+}
+
 } //cellular namespace
 } //bio namespace
@@ -31,7 +31,7 @@ Affinity::~Affinity()
 
 Affinity::Strength Affinity::GetStrengthOfAttractionTo(const physical::Wave* wave) const
 {
-	Strength ret = Affinity::GetStrengthOfAttractionTo(wave);
+	Strength ret = ::bio::Affinity::GetStrengthOfAttractionTo(wave);
 	const Substance* substance = ChemicalCast< const Substance* >(wave);
 	BIO_SANITIZE(substance,,return ret)
 	ret += MeasureAttractionAlong< Filter >(substance);
@@ -257,6 +257,21 @@ const Bonds* Atom::GetAllBonds() const
 	return &mBonds;
 }
 
+physical::Line* Atom::GetLinearContents()
+{
+	return NULL;
+}
+
+const physical::Line* Atom::GetLinearContents() const
+{
+	return NULL;
+}
+
+physical::Identifiable< Id >* Atom::AddLinearContent(physical::Wave* /*content*/)
+{
+	return NULL;
+}
+
 
 } //chemical namespace
 } //bio namespace
@@ -0,0 +1,205 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2023 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "bio/chemical/mixture/MiscibilityMatrix.h"
+#include "bio/chemical/mixture/Miscibility.h"
+#include "bio/chemical/common/Types.h"
+#include "bio/chemical/relativity/PeriodicTable.h"
+#include "bio/physical/symmetry/Symmetry.h"
+
+#include <algorithm>
+
+namespace bio {
+namespace chemical {
+
+MiscibilityMatrix::Entry::Entry()
+	:
+	mFound(false)
+{
+
+}
+
+MiscibilityMatrix::MiscibilityMatrix()
+	:
+	mGeneration(0),
+	mTypeGeneration(0),
+	mPropertiesGeneration(0)
+{
+
+}
+
+MiscibilityMatrix::~MiscibilityMatrix()
+{
+
+}
+
+void MiscibilityMatrix::GetMiscibilities(
+	const Substance* target,
+	const Substance* source,
+	Mix::Miscibilities& miscibilities
+)
+{
+	LockThread();
+	CheckForChanges();
+	Index targetSet = GetPropertySetIdOf(target);
+	Index sourceSet = GetPropertySetIdOf(source);
+	const Entry& entry = GetEntry(
+		targetSet,
+		sourceSet
+	);
+	miscibilities.insert(
+		miscibilities.end(),
+		entry.mMiscibilities.begin(),
+		entry.mMiscibilities.end());
+	UnlockThread();
+}
+
+void MiscibilityMatrix::Clear()
+{
+	LockThread();
+	mPropertySetIds.clear();
+	mSortedSets.clear();
+	mOrderedSets.clear();
+	mTypeSetIds.clear();
+	mMatrix.clear();
+	UnlockThread();
+}
+
+void MiscibilityMatrix::CheckForChanges()
+{
+	uint32_t generation = MiscibilityPerspective::Instance().GetGeneration();
+	uint32_t typeGeneration = MiscibilityPerspective::Instance().GetTypeGeneration();
+	uint32_t propertiesGeneration = PeriodicTable::Instance().GetPropertiesGeneration();
+	if (generation == mGeneration && typeGeneration == mTypeGeneration && propertiesGeneration == mPropertiesGeneration)
+	{
+		return;
+	}
+	mPropertySetIds.clear();
+	mSortedSets.clear();
+	mOrderedSets.clear();
+	mTypeSetIds.clear();
+	mMatrix.clear();
+	mGeneration = generation;
+	mTypeGeneration = typeGeneration;
+	mPropertiesGeneration = propertiesGeneration;
+}
+
+Index MiscibilityMatrix::GetPropertySetIdOf(const Substance* substance)
+{
+	//The Symmetry of a chemical::Class is named for its type, so its Id stands in for the type.
+	const physical::Wave* wave = substance->AsWave();
+	const physical::Symmetry* symmetry = wave->GetSymmetry();
+	Index type = symmetry ? symmetry->GetId().mT : InvalidIndex();
+	if (type < mTypeSetIds.size() && mTypeSetIds[type] != InvalidIndex())
+	{
+		return mTypeSetIds[type];
+	}
+
+	const Properties properties = wave->GetProperties();
+	PropertySet ordered;
+	for (
+		SmartIterator prp = properties.Begin();
+		!prp.IsAfterEnd();
+		++prp
+		)
+	{
+		ordered.push_back(prp.As< Property >().mT);
+	}
+	Index ret = GetPropertySetId(ordered);
+	if (symmetry)
+	{
+		if (mTypeSetIds.size() <= type)
+		{
+			mTypeSetIds.resize(
+				type + 1,
+				InvalidIndex()
+			);
+		}
+		mTypeSetIds[type] = ret;
+	}
+	return ret;
+}
+
+Index MiscibilityMatrix::GetPropertySetId(const PropertySet& properties)
+{
+	PropertySet sorted = properties;
+	::std::sort(
+		sorted.begin(),
+		sorted.end());
+	PropertySetIds::iterator found = mPropertySetIds.find(sorted);
+	if (found != mPropertySetIds.end())
+	{
+		return found->second;
+	}
+	Index id = mSortedSets.size();
+	mPropertySetIds[sorted] = id;
+	mSortedSets.push_back(sorted);
+	mOrderedSets.push_back(properties);
+	return id;
+}
+
+const MiscibilityMatrix::Entry& MiscibilityMatrix::GetEntry(
+	Index target,
+	Index source
+)
+{
+	if (mMatrix.size() <= target)
+	{
+		mMatrix.resize(target + 1);
+	}
+	if (mMatrix[target].size() <= source)
+	{
+		mMatrix[target].resize(source + 1);
+	}
+	Entry& entry = mMatrix[target][source];
+	if (entry.mFound)
+	{
+		return entry;
+	}
+
+	//Each shared Property has its own Miscibility, which is applied in the order of the target's Properties.
+	const PropertySet& sourceSet = mSortedSets[source];
+	const PropertySet& targetProperties = mOrderedSets[target];
+	const Miscibility* miscibility;
+	for (
+		PropertySet::const_iterator prp = targetProperties.begin();
+		prp != targetProperties.end();
+		++prp
+		)
+	{
+		if (!::std::binary_search(
+			sourceSet.begin(),
+			sourceSet.end(),
+			*prp))
+		{
+			continue;
+		}
+		miscibility = MiscibilityPerspective::Instance().GetTypeFromIdAs< Miscibility* >(Property(*prp));
+		BIO_SANITIZE(miscibility,,continue)
+		entry.mMiscibilities.push_back(miscibility);
+	}
+	entry.mFound = true;
+	return entry;
+}
+
+} //chemical namespace
+} //bio namespace
@@ -21,6 +21,7 @@
 
 #include "bio/chemical/mixture/Mix.h"
 #include "bio/chemical/mixture/Miscibility.h"
+#include "bio/chemical/mixture/MiscibilityMatrix.h"
 #include "bio/chemical/common/Class.h"
 #include "bio/chemical/common/Filters.h"
 
@@ -48,7 +49,7 @@ Products Mix::Process(Reactants* reactants) const
 {
 	SmartIterator sub = reactants->Covalent< LinearMotif< Substance* > >::Object()->GetAllImplementation()->Begin();
 	Substance* primeSubstance = sub.As< Substance* >();
-	const Miscibility* miscibility = NULL;
+	Miscibilities miscibilities;
 	for (
 		++sub;
 		!sub.IsAfterEnd();
@@ -56,34 +57,65 @@ Products Mix::Process(Reactants* reactants) const
 	)
 	{
 		const Substance* substance = sub.As< Substance* >();
-
-		//Each Property has its own Miscibility and is Superposed separately.
-		const Properties properties = physical::Wave::GetResonanceBetween(primeSubstance->AsWave(), substance->AsWave());
-		for (
-			SmartIterator prp = properties.Begin();
-			!prp.IsAfterEnd();
-			++prp
-			)
-		{
-			miscibility = MiscibilityPerspective::Instance().GetTypeFromIdAs< Miscibility* >(prp.As< Property >());
-			BIO_SANITIZE(miscibility,,continue)
-			
-			//The miscibility must perform the appropriate cast of sub.Protperty::Type
-			//Superpose should now be able to ForceCast the displacement to what it expects.
-			const Wave* displacement = miscibility->GetDisplacement(substance);
-	
-			//Interference gives us the Superposition for the primeSubstance's Symmetry, and thus determines how the Superposed Wave will Collapse.
-			BIO_SANITIZE(primeSubstance->Superpose(displacement, miscibility->GetInterference()),,continue)
-		}
+		miscibilities.clear();
+		GetMiscibilities(
+			primeSubstance,
+			substance,
+			miscibilities
+		);
+		Superpose(
+			primeSubstance,
+			substance,
+			miscibilities
+		);
 	}
 	return reactants;
 }
 
+/*static*/ void Mix::GetMiscibilities(
+	const Substance* target,
+	const Substance* source,
+	Miscibilities& miscibilities
+)
+{
+	GlobalMiscibilityMatrix::Instance().GetMiscibilities(
+		target,
+		source,
+		miscibilities
+	);
+}
+
+/*static*/ void Mix::Superpose(
+	Substance* target,
+	const Substance* source,
+	const Miscibilities& miscibilities
+)
+{
+	for (
+		Miscibilities::const_iterator msc = miscibilities.begin();
+		msc != miscibilities.end();
+		++msc
+		)
+	{
+		//The miscibility must perform the appropriate cast of sub.Protperty::Type
+		//Superpose should now be able to ForceCast the displacement to what it expects.
+		const Wave* displacement = (*msc)->GetDisplacement(source);
+
+		//Interference gives us the Superposition for the target's Symmetry, and thus determines how the Superposed Wave will Collapse.
+		BIO_SANITIZE(target->Superpose(displacement, (*msc)->GetInterference()),,continue)
+	}
+}
+
 bool Mix::ReactantsMeetRequirements(const Reactants* toCheck) const
 {
 	//Lengthy call to be a bit more optimized than the easier GetCount< Substance* >() method.
 	return toCheck->Covalent< LinearMotif< Substance* > >::Object()->GetCountImplementation() > 1;
 }
 
+bool Mix::HasRequirements() const
+{
+	return true;
+}
+
 } //chemical namespace
 } //bio namespace
@@ -86,6 +86,11 @@ Products::operator Reactants()
 	return Reactants(mSubstances);
 }
 
+const Substances& Products::GetSubstances() const
+{
+	return mSubstances;
+}
+
 bool Products::operator!=(const Code code) const
 {
 	return mResult != code;
@@ -20,6 +20,7 @@
  */
 
 #include "bio/chemical/reaction/Reactant.h"
+#include "bio/chemical/relativity/PeriodicTable.h"
 #include "bio/common/string/String.h"
 
 namespace bio {
@@ -28,7 +29,8 @@ namespace chemical {
 Reactant::Reactant() :
 	chemical::Class< Reactant >(this),
 	Substance(),
-	mTypeName(NULL)
+	mTypeName(NULL),
+	mCompiled(false)
 {
 
 }
@@ -37,7 +39,8 @@ Reactant::Reactant(const Name& typeName)
 	:
 	chemical::Class< Reactant >(this),
 	Substance(),
-	mTypeName(typeName)
+	mTypeName(typeName),
+	mCompiled(false)
 {
 
 }
@@ -53,7 +56,8 @@ Reactant::Reactant(
 		properties,
 		states
 	),
-	mTypeName(typeName)
+	mTypeName(typeName),
+	mCompiled(false)
 {
 
 }
@@ -65,7 +69,8 @@ Reactant::Reactant(
 	:
 	chemical::Class< Reactant >(this),
 	Substance(*substance),
-	mTypeName(typeName)
+	mTypeName(typeName),
+	mCompiled(false)
 {
 
 }
@@ -81,5 +86,31 @@ bool Reactant::operator==(const Substance& other) const
 	return Substance::operator==(other) && other.GetBondPosition(mTypeName) != 0;
 }
 
+bool Reactant::Matches(const Substance* candidate) const
+{
+	BIO_SANITIZE(candidate, , return false)
+	if (!mCompiled)
+	{
+		Compile();
+	}
+	if (mNumProperties && CountMasked< Property >(candidate->GetAll< Property >(), mPropertyMask) < mNumProperties)
+	{
+		return false;
+	}
+	if (mNumStates && CountMasked< State >(candidate->GetAll< State >(), mStateMask) < mNumStates)
+	{
+		return false;
+	}
+	return candidate->GetBondPosition(mTypeId) != 0;
+}
+
+void Reactant::Compile() const
+{
+	mTypeId = mTypeName ? SafelyAccess< PeriodicTable >()->GetIdFromName(mTypeName) : PeriodicTable::InvalidId();
+	mNumProperties = Mask< Property >(GetAll< Property >(), mPropertyMask);
+	mNumStates = Mask< State >(GetAll< State >(), mStateMask);
+	mCompiled = true;
+}
+
 } //chemical namespace
 } //bio namespace
@@ -55,5 +55,19 @@ Reactants::operator Substances()
 	return GetAll< Substance* >();
 }
 
+void Reactants::Replace(const Substances& substances)
+{
+	LinearMotif< Substance* >* contents = Covalent< LinearMotif< Substance* > >::Object();
+	contents->ClearImplementation();
+	for (
+		SmartIterator sub = substances.Begin();
+		!sub.IsAfterEnd();
+		++sub
+		)
+	{
+		contents->AddImplementation(sub.As< Substance* >());
+	}
+}
+
 } //chemical namespace
 } //bio namespace
@@ -75,12 +75,49 @@ void Reaction::Require(
 
 bool Reaction::ReactantsMeetRequirements(const Reactants* toCheck) const
 {
-	return toCheck->HasAll< Substance* >(mRequiredReactants.GetAll< Substance* >());
+	BIO_SANITIZE(toCheck, , return false)
+	const Container* required = mRequiredReactants.GetAll< Substance* >();
+	const Container* candidates = toCheck->GetAll< Substance* >();
+	if (!required || !required->GetNumberOfElements())
+	{
+		return true;
+	}
+	if (!candidates || candidates->GetNumberOfElements() < required->GetNumberOfElements())
+	{
+		return false;
+	}
+
+	//ORDER MATTERS: each required Reactant is Matched against the candidate in the same position.
+	const Reactant* reactant;
+	SmartIterator can = candidates->Begin();
+	for (
+		SmartIterator req = required->Begin();
+		!req.IsAfterEnd();
+		++req, ++can
+		)
+	{
+		reactant = ChemicalCast< const Reactant* >(req.As< Substance* >());
+		if (!reactant)
+		{
+			//Not a Reactant, so we can't Match it quickly.
+			return toCheck->HasAll< Substance* >(required);
+		}
+		if (!reactant->Matches(can.As< Substance* >()))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool Reaction::HasRequirements() const
+{
+	return mRequiredReactants.GetCount< Substance* >() > 0;
 }
 
 /*static*/ const Reaction* Reaction::Initiate(const AtomicNumber& id)
 {
-	BIO_SANITIZE_WITH_CACHE(SafelyAccess< PeriodicTable >()->GetTypeFromIdAs< Reaction* >(id),
+	BIO_SANITIZE_WITH_CACHE(PeriodicTable::Instance().GetTypeFromIdAs< Reaction* >(id),
 		return Cast< Reaction* >(RESULT),
 		return NULL);
 }
@@ -26,6 +26,8 @@ namespace bio {
 namespace chemical {
 
 PeriodicTableImplementation::PeriodicTableImplementation()
+	:
+	mPropertiesGeneration(0)
 {
 
 }
@@ -89,6 +91,7 @@ AtomicNumber PeriodicTableImplementation::RecordPropertiesOf(
 		return InvalidId();
 	}
 	element->mProperties.Import(properties);
+	++mPropertiesGeneration;
 	return id;
 }
 
@@ -103,5 +106,10 @@ AtomicNumber PeriodicTableImplementation::RecordPropertiesOf(
 	);
 }
 
+uint32_t PeriodicTableImplementation::GetPropertiesGeneration() const
+{
+	return mPropertiesGeneration;
+}
+
 } //chemical namespace
 } //bio namespace
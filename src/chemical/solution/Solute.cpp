@@ -125,6 +125,10 @@ Code Solute::Crest()
 	{
 		return code::NoErrorNoSuccess();
 	}
+	if (GetEnvironment() && GetEnvironment()->DiffusesSolutes())
+	{
+		return code::NoErrorNoSuccess(); //our Solution Diffuses us with everything else.
+	}
 	Diffuse();
 	return code::Success();
 }
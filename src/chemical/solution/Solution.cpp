@@ -21,10 +21,17 @@
 
 #include "bio/chemical/solution/Solution.h"
 #include "bio/chemical/solution/Solute.h"
+#include "bio/chemical/mixture/Mix.h"
+#include "bio/physical/Time.h"
 
 namespace bio {
 namespace chemical {
 
+void Solution::CommonConstructor()
+{
+	mDiffusesSolutes = false;
+}
+
 Id Solution::Dissolve(
 	Substance* toDissolve,
 	const DiffusionTime& diffusionTime,
@@ -129,6 +136,94 @@ const Solute Solution::operator[](const Name& substanceName) const
 	return Efflux(substanceName);
 }
 
+void Solution::SetDiffusesSolutes(bool diffusesSolutes)
+{
+	mDiffusesSolutes = diffusesSolutes;
+}
+
+bool Solution::DiffusesSolutes() const
+{
+	return mDiffusesSolutes;
+}
+
+Code Solution::Diffuse()
+{
+	Code ret = code::NoErrorNoSuccess();
+	const Timestamp now = physical::GetCurrentTimestamp();
+	Mix::Miscibilities miscibilities;
+	Solute* solute;
+	Solute* child;
+	Substance* target;
+	const Substance* source;
+	for (
+		SmartIterator slt = mSolutes.Begin();
+		!slt.IsAfterEnd();
+		++slt
+		)
+	{
+		solute = slt.As< Solute* >();
+		if (!solute || solute->mDiffusionTime != diffusion::time::Interval())
+		{
+			continue;
+		}
+		if (now - solute->GetTimeLastCrested() < solute->GetInterval())
+		{
+			continue; //not due yet, just as if the Solute were CheckIn()ed itself.
+		}
+		solute->SetLastCrestTimestamp(now);
+		ret = code::Success();
+
+		//Active() Diffusion Influxes a single Solute, so there's nothing to batch.
+		if (solute->GetEnvironment() &&
+			(solute->mDiffusionEffort == diffusion::effort::Active() || solute->mDiffusionEffort == diffusion::effort::ActiveAndPassive())
+		)
+		{
+			solute->Diffuse();
+			continue;
+		}
+		if (solute->GetConcentration() <= 1 ||
+			(solute->mDiffusionEffort != diffusion::effort::Passive() && solute->mDiffusionEffort != diffusion::effort::ActiveAndPassive())
+		)
+		{
+			continue; //as in Solute::Diffuse(), a Solute with no Effluxed children has nothing to push to.
+		}
+
+		//All children hold (Clones of) the same Substance, so they all share the same Miscibilities.
+		source = solute->mDissolvedSubstance;
+		BIO_SANITIZE(source,,continue)
+		miscibilities.clear();
+		bool foundMiscibilities = false;
+		for (
+			SmartIterator cld = solute->Begin();
+			!cld.IsAfterEnd();
+			++cld
+			)
+		{
+			child = cld.As< Solute* >();
+			target = child ? child->mDissolvedSubstance : NULL;
+			if (!target)
+			{
+				continue; //read-only children see source directly.
+			}
+			if (!foundMiscibilities)
+			{
+				Mix::GetMiscibilities(
+					target,
+					source,
+					miscibilities
+				);
+				foundMiscibilities = true;
+			}
+			Mix::Superpose(
+				target,
+				source,
+				miscibilities
+			);
+		}
+	}
+	return ret;
+}
+
 physical::Line* Solution::GetAllSolutes()
 {
 	return &mSolutes;
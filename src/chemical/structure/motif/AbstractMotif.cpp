@@ -22,9 +22,27 @@
 #include "bio/chemical/structure/motif/AbstractMotif.h"
 #include "bio/chemical/common/Properties.h"
 
+//@formatter:off
+#if BIO_CPP_VERSION >= 11
+	#include <atomic>
+#endif
+//@formatter:on
+
 namespace bio {
 namespace chemical {
 
+/**
+ * The source of all Revisions. <br />
+ * 0 is never given out, so that an unset Revision never matches a real one. <br />
+ */
+//@formatter:off
+#if BIO_CPP_VERSION >= 11
+	static ::std::atomic< Revision > sLatestRevision(0);
+#else
+	static Revision sLatestRevision = 0;
+#endif
+//@formatter:on
+
 /*static*/ Properties AbstractMotif::GetClassProperties()
 {
 	Properties ret;
@@ -34,9 +52,10 @@ namespace chemical {
 
 AbstractMotif::AbstractMotif()
 	:
-	mContents(NULL)
+	mContents(NULL),
+	mRevision(0)
 {
-
+	Revise();
 }
 
 AbstractMotif::~AbstractMotif()
@@ -58,5 +77,10 @@ const Container* AbstractMotif::GetAllImplementation() const
 	return this->mContents;
 }
 
+void AbstractMotif::Revise()
+{
+	this->mRevision = ++sLatestRevision;
+}
+
 } //chemical namespace
 } //bio namespace
@@ -0,0 +1,446 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2023 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "bio/chemical/symmetry/Checkpoint.h"
+#include "bio/physical/Time.h"
+#include "bio/common/macro/OSMacros.h"
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+namespace bio {
+namespace chemical {
+
+Checkpoint::Checkpoint(
+	const char* path,
+	Index compactEvery
+)
+	:
+	mPath(path ? path : ""),
+	mLogPath(mPath + ".delta"),
+	mCompactEvery(compactEvery),
+	mNumDeltas(0),
+	mHasBase(false),
+	mGeneration(0),
+	mMode(FULL),
+	mPosition(0),
+	mStructureChanged(false)
+{
+
+}
+
+Checkpoint::~Checkpoint()
+{
+	Untrack();
+}
+
+Code Checkpoint::Take(const physical::Wave* root)
+{
+	BIO_SANITIZE(root, ,
+		return code::BadArgument1())
+	if (!mHasBase || mNumDeltas >= mCompactEvery)
+	{
+		return Compact(root);
+	}
+
+	LockThread();
+	if (mStructureChanged)
+	{
+		UnlockThread();
+		return Compact(root);
+	}
+	::std::vector< Index > dirty;
+	dirty.swap(mDirty);
+	mDelta.Clear();
+	for (
+		::std::vector< Index >::const_iterator drt = dirty.begin();
+		drt != dirty.end();
+		++drt
+		)
+	{
+		mIsDirty[*drt] = false;
+		mDelta.Record(
+			mTracked[*drt],
+			NoParent(),
+			Id(*drt));
+	}
+	UnlockThread();
+	if (!mDelta.GetNumberOfRecords())
+	{
+		return code::Success();
+	}
+
+	//[length][generation][Snapshot]
+	::std::vector< char > bytes(sizeof(uint32_t) + sizeof(uint64_t));
+	mDelta.Encode(bytes);
+	mDelta.Clear();
+	uint32_t length = uint32_t(bytes.size() - sizeof(uint32_t));
+	::std::memcpy(
+		&bytes[0],
+		&length,
+		sizeof(length));
+	::std::memcpy(
+		&bytes[sizeof(uint32_t)],
+		&mGeneration,
+		sizeof(mGeneration));
+
+	::std::FILE* log = ::std::fopen(
+		mLogPath.c_str(),
+		"ab"
+	);
+	if (!log)
+	{
+		return code::GeneralFailure();
+	}
+	bool written = ::std::fwrite(
+		&bytes[0],
+		1,
+		bytes.size(),
+		log
+	) == bytes.size();
+	written = (::std::fclose(log) == 0) && written;
+	if (!written)
+	{
+		return code::GeneralFailure();
+	}
+	++mNumDeltas;
+	return code::Success();
+}
+
+Code Checkpoint::Compact(const physical::Wave* root)
+{
+	BIO_SANITIZE(root, ,
+		return code::BadArgument1())
+
+	Timestamp started = physical::GetCurrentTimestamp();
+	mGeneration = started > mGeneration ? started : mGeneration + 1;
+	Walk(
+		root,
+		FULL
+	);
+	ClearDirty(); //the full Snapshot has everything.
+	RecordGeneration();
+
+	//Write somewhere else first, so that a crash never leaves us without a full Snapshot.
+	::std::string temporary = mPath + ".tmp";
+	Code ret = Write(temporary.c_str());
+	Clear();
+	if (ret != code::Success())
+	{
+		return ret;
+	}
+	#ifdef BIO_OS_IS_WINDOWS
+	::std::remove(mPath.c_str());
+	#endif
+	if (::std::rename(
+		temporary.c_str(),
+		mPath.c_str()) != 0)
+	{
+		return code::GeneralFailure();
+	}
+
+	::std::FILE* log = ::std::fopen(
+		mLogPath.c_str(),
+		"wb"
+	);
+	if (!log)
+	{
+		return code::GeneralFailure();
+	}
+	::std::fclose(log);
+
+	mHasBase = true;
+	mNumDeltas = 0;
+	return code::Success();
+}
+
+Code Checkpoint::Recover(physical::Wave* root)
+{
+	BIO_SANITIZE(root, ,
+		return code::BadArgument1())
+
+	Code ret = Read(mPath.c_str());
+	if (ret != code::Success())
+	{
+		return ret;
+	}
+	uint64_t generation = GetRecordedGeneration();
+	ret = Restore(root);
+	if (ret != code::Success())
+	{
+		return ret;
+	}
+
+	//root is ours to change, so it's okay to Reify what we Collect from it.
+	Walk(
+		root,
+		COLLECT
+	);
+	mGeneration = generation;
+	mHasBase = true;
+	mNumDeltas = 0;
+
+	::std::vector< char > bytes;
+	::std::FILE* log = ::std::fopen(
+		mLogPath.c_str(),
+		"rb"
+	);
+	if (log)
+	{
+		char buffer[4096];
+		::std::size_t got;
+		while ((got = ::std::fread(
+			buffer,
+			1,
+			sizeof(buffer),
+			log
+		)) > 0)
+		{
+			bytes.insert(
+				bytes.end(),
+				buffer,
+				buffer + got
+			);
+		}
+		::std::fclose(log);
+	}
+
+	physical::Snapshot delta;
+	uint32_t length;
+	uint64_t deltaGeneration;
+	::std::size_t position = 0;
+	while (bytes.size() - position >= sizeof(length) + sizeof(deltaGeneration))
+	{
+		::std::memcpy(
+			&length,
+			&bytes[position],
+			sizeof(length));
+		position += sizeof(length);
+		if (length < sizeof(deltaGeneration) || bytes.size() - position < length)
+		{
+			break; //a delta was cut off part way through; everything before it is still good.
+		}
+		::std::memcpy(
+			&deltaGeneration,
+			&bytes[position],
+			sizeof(deltaGeneration));
+		const char* encoded = &bytes[position + sizeof(deltaGeneration)];
+		position += length;
+		if (deltaGeneration != generation)
+		{
+			continue;
+		}
+		if (delta.Load(
+			encoded,
+			length - sizeof(deltaGeneration)) != code::Success())
+		{
+			break;
+		}
+		for (
+			Index rcd = 0;
+			rcd < delta.GetNumberOfRecords();
+			++rcd
+			)
+		{
+			Index changed = delta.GetId(rcd).mT;
+			const physical::Symmetry* symmetry = delta.GetSymmetry(rcd);
+			if (changed < mCollected.size() && symmetry)
+			{
+				const_cast< physical::Wave* >(mCollected[changed])->Reify(symmetry);
+			}
+		}
+		++mNumDeltas;
+	}
+	mCollected.clear();
+	ClearDirty(); //root now matches what is saved.
+	return code::Success();
+}
+
+Index Checkpoint::GetNumberOfDeltas() const
+{
+	return mNumDeltas;
+}
+
+void Checkpoint::Note(physical::Symmetry* changed)
+{
+	LockThread();
+	Positions::const_iterator found = mPositions.find(changed);
+	if (found != mPositions.end() && !mIsDirty[found->second])
+	{
+		mIsDirty[found->second] = true;
+		mDirty.push_back(found->second);
+	}
+	UnlockThread();
+}
+
+void Checkpoint::Forget(physical::Symmetry* gone)
+{
+	LockThread();
+	Positions::iterator found = mPositions.find(gone);
+	if (found != mPositions.end())
+	{
+		mTracked[found->second] = NULL;
+		mPositions.erase(found);
+		mStructureChanged = true;
+	}
+	UnlockThread();
+}
+
+void Checkpoint::RecordPerspectives()
+{
+	if (mMode == FULL)
+	{
+		Snapshot::RecordPerspectives();
+	}
+}
+
+Index Checkpoint::RecordWave(
+	const physical::Wave* wave,
+	Index parent,
+	const physical::Identifiable< Id >* identity,
+	const Link& link
+)
+{
+	Index position = mPosition++;
+	switch (mMode)
+	{
+		case FULL:
+			Snapshot::RecordWave(
+				wave,
+				parent,
+				identity,
+				link
+			);
+			break;
+		case COLLECT:
+			mCollected.push_back(wave);
+			break;
+	}
+	Track(
+		wave,
+		position
+	);
+	return position;
+}
+
+void Checkpoint::Walk(
+	const physical::Wave* root,
+	Mode mode
+)
+{
+	Untrack();
+	mMode = mode;
+	mPosition = 0;
+	mCollected.clear();
+	Capture(root);
+}
+
+void Checkpoint::RecordGeneration()
+{
+	::std::ostringstream generation;
+	generation << mGeneration;
+	Table table;
+	table.mName = "Checkpoint";
+	table.mNames.push_back(generation.str());
+	mTables.push_back(table);
+}
+
+uint64_t Checkpoint::GetRecordedGeneration() const
+{
+	const Table* table = GetTable("Checkpoint");
+	if (!table || table->mNames.empty())
+	{
+		return 0;
+	}
+	uint64_t ret = 0;
+	::std::istringstream generation(table->mNames[0]);
+	generation >> ret;
+	return ret;
+}
+
+void Checkpoint::Track(
+	const physical::Wave* wave,
+	Index position
+)
+{
+	//We only read from wave, but its Symmetry must tell us when it is written to.
+	physical::Symmetry* symmetry = const_cast< physical::Symmetry* >(wave->Spin());
+	LockThread();
+	if (mTracked.size() <= position)
+	{
+		mTracked.resize(
+			position + 1,
+			NULL
+		);
+		mIsDirty.resize(
+			position + 1,
+			false
+		);
+	}
+	if (symmetry && mPositions.find(symmetry) == mPositions.end())
+	{
+		mTracked[position] = symmetry;
+		mPositions[symmetry] = position;
+		symmetry->SetJournal(this);
+	}
+	UnlockThread();
+}
+
+void Checkpoint::Untrack()
+{
+	LockThread();
+	for (
+		::std::vector< physical::Symmetry* >::iterator trk = mTracked.begin();
+		trk != mTracked.end();
+		++trk
+		)
+	{
+		if (*trk && (*trk)->GetJournal() == this)
+		{
+			(*trk)->SetJournal(NULL);
+		}
+	}
+	mTracked.clear();
+	mPositions.clear();
+	mIsDirty.clear();
+	mDirty.clear();
+	mStructureChanged = false;
+	UnlockThread();
+}
+
+void Checkpoint::ClearDirty()
+{
+	LockThread();
+	for (
+		::std::vector< Index >::const_iterator drt = mDirty.begin();
+		drt != mDirty.end();
+		++drt
+		)
+	{
+		mIsDirty[*drt] = false;
+	}
+	mDirty.clear();
+	UnlockThread();
+}
+
+} //chemical namespace
+} //bio namespace
@@ -0,0 +1,560 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2023 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "bio/chemical/symmetry/Snapshot.h"
+#include "bio/chemical/bonding/Atom.h"
+#include "bio/chemical/common/Types.h"
+#include "bio/chemical/relativity/PeriodicTable.h"
+#include "bio/physical/shape/Line.h"
+
+namespace bio {
+namespace chemical {
+
+/**
+ * The Symmetry of any chemical::Class is Named after its type, so we use that to find the type in the PeriodicTable. <br />
+ * @param wave
+ * @return the AtomicNumber of the type of the given Wave or 0.
+ */
+static AtomicNumber GetAtomicNumberOf(const physical::Wave* wave)
+{
+	const physical::Symmetry* symmetry = wave->Spin();
+	if (!symmetry || !symmetry->GetName())
+	{
+		return 0;
+	}
+	return PeriodicTable::Instance().GetIdWithoutCreation(symmetry->GetName());
+}
+
+Snapshot::Snapshot()
+{
+
+}
+
+Snapshot::~Snapshot()
+{
+
+}
+
+Code Snapshot::Capture(const physical::Wave* root)
+{
+	Clear();
+	BIO_SANITIZE(root, ,
+		return code::BadArgument1())
+	RecordPerspectives();
+	Visited visited;
+	CaptureWave(
+		root,
+		NoParent(),
+		NULL,
+		Link(ROOT),
+		visited
+	);
+	return code::Success();
+}
+
+Code Snapshot::Restore(physical::Wave* root) const
+{
+	BIO_SANITIZE(root, ,
+		return code::BadArgument1())
+	if (!GetNumberOfRecords())
+	{
+		return code::CouldNotFindValue1();
+	}
+	Remap remap;
+	Code ret = RestorePerspectives(remap);
+	if (ret != code::Success())
+	{
+		return ret;
+	}
+	Index next = 0;
+	Visited visited;
+	ret = RestoreWave(
+		root,
+		NoParent(),
+		NULL,
+		next,
+		visited,
+		remap
+	);
+	if (ret == code::Success() && next != GetNumberOfRecords())
+	{
+		ret = code::BadArgument1();
+	}
+	return ret;
+}
+
+physical::Wave* Snapshot::Restore() const
+{
+	Index numRecords = GetNumberOfRecords();
+	Remap remap;
+	if (!numRecords || RestorePerspectives(remap) != code::Success())
+	{
+		return NULL;
+	}
+
+	//Parents are always Recorded before what they hold, so one pass in order is enough.
+	::std::vector< physical::Wave* > waves(
+		numRecords,
+		NULL
+	);
+	physical::Wave* wave;
+	physical::Identifiable< Id >* identity;
+	for (
+		Index rcd = 0;
+		rcd < numRecords;
+		++rcd
+		)
+	{
+		Link link = GetLink(rcd);
+		Index parent = GetParent(rcd);
+		Atom* holder = NULL;
+		if (parent != NoParent())
+		{
+			if (parent >= rcd || !waves[parent] || !(holder = waves[parent]->AsAtom()))
+			{
+				continue; //whatever held this could not be created, so neither can this.
+			}
+		}
+		else if (rcd || link.mKind != ROOT)
+		{
+			continue; //only the first record may be the root.
+		}
+		wave = NULL;
+		identity = NULL;
+
+		//Every Recorded Id is looked up by its Recorded Name, since this process may have given out Ids in a different order.
+		AtomicNumber type = Remapped(
+			remap.mAtomicNumbers,
+			link.mClass
+		);
+		switch (link.mKind)
+		{
+			case ROOT:
+				if (!holder && type)
+				{
+					wave = PeriodicTable::Instance().GetNewObjectFromId(type);
+				}
+				break;
+			case BONDED:
+			{
+				AtomicNumber bondId = Remapped(
+					remap.mAtomicNumbers,
+					link.mId
+				);
+				if (!bondId)
+				{
+					break;
+				}
+				Valence position = holder->GetBondPosition(bondId);
+				if (position)
+				{
+					wave = holder->GetBonded(position); //e.g. Formed by the holder's constructor.
+					break;
+				}
+				wave = PeriodicTable::Instance().GetNewObjectFromId(type ? type : bondId);
+				if (wave)
+				{
+					holder->FormBondImplementation(
+						wave,
+						bondId,
+						Remapped(
+							remap.mBondTypes,
+							link.mType
+						));
+				}
+				break;
+			}
+			case CONTENT:
+			{
+				physical::Line* contents = holder->GetLinearContents();
+				if (!contents)
+				{
+					break;
+				}
+				Name name = GetName(rcd);
+				Id id = Remapped(
+					remap.mIds,
+					GetId(rcd).mT
+				);
+				Index found = name ? contents->SeekToName(name) : (id ? contents->SeekToId(id) : InvalidIndex());
+				if (found)
+				{
+					identity = contents->LinearAccess(found); //e.g. created by the holder's constructor.
+					wave = identity;
+					break;
+				}
+				if (!type)
+				{
+					break;
+				}
+				wave = PeriodicTable::Instance().GetNewObjectFromId(type);
+				if (!wave)
+				{
+					break;
+				}
+				identity = holder->AddLinearContent(wave);
+				if (!identity)
+				{
+					delete wave;
+					wave = NULL;
+				}
+				break;
+			}
+			default:
+				break;
+		}
+		if (!wave)
+		{
+			if (!rcd)
+			{
+				return NULL;
+			}
+			continue;
+		}
+
+		RestoreRecord(
+			wave,
+			identity,
+			rcd,
+			remap
+		);
+		if (holder && link.mKind == CONTENT && holder->GetLinearContents())
+		{
+			holder->GetLinearContents()->InvalidateIdIndex(); //the Contents may have been renamed.
+		}
+		waves[rcd] = wave;
+	}
+	return waves[0];
+}
+
+void Snapshot::CapturePerspectives()
+{
+	Clear();
+	RecordPerspectives();
+}
+
+Code Snapshot::Preload(
+	const char* path,
+	bool deferTypes
+)
+{
+	if (deferTypes)
+	{
+		SafelyAccess< PeriodicTable >()->DeferTypes();
+	}
+	Code ret = Read(path);
+	if (ret != code::Success())
+	{
+		return ret;
+	}
+	Remap remap;
+	return RestorePerspectives(remap);
+}
+
+void Snapshot::RecordPerspectives()
+{
+	RecordPerspective("Id", IdPerspective::Instance());
+	RecordPerspective("PeriodicTable", PeriodicTable::Instance());
+	RecordPerspective("Property", PropertyPerspective::Instance());
+	RecordPerspective("State", StatePerspective::Instance());
+	RecordPerspective("Symmetry", physical::SymmetryPerspective::Instance());
+	RecordPerspective("SymmetryType", SymmetryTypePerspective::Instance());
+	RecordPerspective("BondType", BondTypePerspective::Instance());
+	RecordPerspective("Code", CodePerspective::Instance());
+	RecordPerspective("Filter", FilterPerspective::Instance());
+	RecordPerspective("DiffusionTime", DiffusionTimePerspective::Instance());
+	RecordPerspective("DiffusionEffort", DiffusionEffortPerspective::Instance());
+}
+
+Code Snapshot::RestorePerspectives(Remap& remap) const
+{
+	//Ids which already exist may have moved (code::SuccessfullyReplaced()); remap handles that.
+	Code results[] = {
+		RestorePerspective("Id", IdPerspective::Instance(), &remap.mIds),
+		RestorePerspective("PeriodicTable", PeriodicTable::Instance(), &remap.mAtomicNumbers),
+		RestorePerspective("Property", PropertyPerspective::Instance()),
+		RestorePerspective("State", StatePerspective::Instance()),
+		RestorePerspective("Symmetry", physical::SymmetryPerspective::Instance()),
+		RestorePerspective("SymmetryType", SymmetryTypePerspective::Instance()),
+		RestorePerspective("BondType", BondTypePerspective::Instance(), &remap.mBondTypes),
+		RestorePerspective("Code", CodePerspective::Instance()),
+		RestorePerspective("Filter", FilterPerspective::Instance()),
+		RestorePerspective("DiffusionTime", DiffusionTimePerspective::Instance()),
+		RestorePerspective("DiffusionEffort", DiffusionEffortPerspective::Instance())
+	};
+	for (
+		::std::size_t rst = 0;
+		rst < sizeof(results) / sizeof(results[0]);
+		++rst
+		)
+	{
+		if (results[rst] != code::Success() && results[rst] != code::SuccessfullyReplaced())
+		{
+			return results[rst];
+		}
+	}
+	return code::Success();
+}
+
+/*static*/ const void* Snapshot::GetVisitKey(const physical::Wave* wave)
+{
+	const Atom* atom = wave->AsAtom();
+	if (atom)
+	{
+		return atom;
+	}
+	return wave;
+}
+
+Index Snapshot::RecordWave(
+	const physical::Wave* wave,
+	Index parent,
+	const physical::Identifiable< Id >* identity,
+	const Link& link
+)
+{
+	return Record(
+		wave->Spin(),
+		parent,
+		identity ? identity->GetId() : Id(0),
+		identity ? identity->GetName() : Name(NULL),
+		link
+	);
+}
+
+void Snapshot::CaptureWave(
+	const physical::Wave* wave,
+	Index parent,
+	const physical::Identifiable< Id >* identity,
+	const Link& link,
+	Visited& visited
+)
+{
+	if (!visited.insert(GetVisitKey(wave)).second)
+	{
+		return;
+	}
+
+	Link recordedLink = link;
+	recordedLink.mClass = GetAtomicNumberOf(wave);
+	Index recorded = RecordWave(
+		wave,
+		parent,
+		identity,
+		recordedLink
+	);
+
+	const Atom* atom = wave->AsAtom();
+	if (!atom)
+	{
+		return;
+	}
+
+	const Bond* bond;
+	for (
+		SmartIterator bnd = atom->GetAllBonds()->Begin();
+		!bnd.IsAfterEnd();
+		++bnd
+		)
+	{
+		bond = bnd;
+		if (!bond || bond->IsEmpty() || !bond->GetBonded())
+		{
+			continue;
+		}
+		CaptureWave(
+			bond->GetBonded(),
+			recorded,
+			NULL,
+			Link(
+				BONDED,
+				bond->GetId(),
+				bond->GetType().mT
+			),
+			visited
+		);
+	}
+
+	const physical::Line* contents = atom->GetLinearContents();
+	if (!contents)
+	{
+		return;
+	}
+	const physical::Identifiable< Id >* content;
+	for (
+		SmartIterator cnt = contents->Begin();
+		!cnt.IsAfterEnd();
+		++cnt
+		)
+	{
+		content = cnt.As< physical::Linear >();
+		if (!content)
+		{
+			continue;
+		}
+		CaptureWave(
+			content,
+			recorded,
+			content,
+			Link(CONTENT),
+			visited
+		);
+	}
+}
+
+Code Snapshot::RestoreWave(
+	physical::Wave* wave,
+	Index parent,
+	physical::Identifiable< Id >* identity,
+	Index& next,
+	Visited& visited,
+	const Remap& remap
+) const
+{
+	if (!visited.insert(GetVisitKey(wave)).second)
+	{
+		return code::Success();
+	}
+
+	Index restoring = next++;
+	if (restoring >= GetNumberOfRecords() || GetParent(restoring) != parent)
+	{
+		return code::BadArgument1();
+	}
+
+	const physical::Symmetry* current = wave->Spin();
+	const physical::Symmetry* recorded = GetSymmetry(restoring);
+	Name recordedName = GetSymmetryName(restoring);
+	if ((current != NULL) != (recorded != NULL) || (current && !(current->GetName() == recordedName)))
+	{
+		return code::BadArgument1();
+	}
+	RestoreRecord(
+		wave,
+		identity,
+		restoring,
+		remap
+	);
+
+	Atom* atom = wave->AsAtom();
+	if (!atom)
+	{
+		return code::Success();
+	}
+
+	Code ret;
+	Bond* bond;
+	for (
+		SmartIterator bnd = atom->GetAllBonds()->Begin();
+		!bnd.IsAfterEnd();
+		++bnd
+		)
+	{
+		bond = bnd;
+		if (!bond || bond->IsEmpty() || !bond->GetBonded())
+		{
+			continue;
+		}
+		ret = RestoreWave(
+			bond->GetBonded(),
+			restoring,
+			NULL,
+			next,
+			visited,
+			remap
+		);
+		if (ret != code::Success())
+		{
+			return ret;
+		}
+	}
+
+	physical::Line* contents = atom->GetLinearContents();
+	if (!contents)
+	{
+		return code::Success();
+	}
+	physical::Identifiable< Id >* content;
+	for (
+		SmartIterator cnt = contents->Begin();
+		!cnt.IsAfterEnd();
+		++cnt
+		)
+	{
+		content = cnt.As< physical::Linear >();
+		if (!content)
+		{
+			continue;
+		}
+		ret = RestoreWave(
+			content,
+			restoring,
+			content,
+			next,
+			visited,
+			remap
+		);
+		if (ret != code::Success())
+		{
+			return ret;
+		}
+	}
+	contents->InvalidateIdIndex(); //the Contents may have been renamed.
+	return code::Success();
+}
+
+void Snapshot::RestoreRecord(
+	physical::Wave* wave,
+	physical::Identifiable< Id >* identity,
+	Index record,
+	const Remap& remap
+) const
+{
+	const physical::Symmetry* current = wave->Spin();
+	const physical::Symmetry* recorded = GetSymmetry(record);
+	if (current && recorded && current->GetName() == GetSymmetryName(record))
+	{
+		wave->Reify(recorded);
+	}
+
+	if (identity)
+	{
+		Name name = GetName(record);
+		if (name && identity->GetPerspective())
+		{
+			identity->SetId(identity->GetPerspective()->GetIdFromName(name)); //keeps the Name held by the Perspective.
+		}
+		else
+		{
+			Id id = Remapped(
+				remap.mIds,
+				GetId(record).mT
+			);
+			if (id)
+			{
+				identity->SetId(id);
+			}
+		}
+	}
+}
+
+} //chemical namespace
+} //bio namespace
@@ -20,6 +20,8 @@
  */
 
 #include "bio/common/ByteStream.h"
+#include <set>
+#include <string>
 
 namespace bio {
 
@@ -97,6 +99,27 @@ void ByteStream::Set(const ByteStream& other)
 	mHolding = true;
 }
 
+void ByteStream::Set(
+	const void* bytes,
+	::std::size_t size,
+	const String& typeName
+)
+{
+	Release();
+	mStream = ::std::malloc(size);
+	memcpy(
+		mStream,
+		bytes,
+		size
+	);
+	mSize = size;
+
+	//Like type::TypeName<>(), we need names which outlive *this, so we keep 1 copy of each.
+	static ::std::set< ::std::string > sTypeNames;
+	mTypeName = sTypeNames.insert(typeName.AsStdString()).first->c_str();
+	mHolding = true;
+}
+
 void ByteStream::Release()
 {
 	if (!mHolding)
@@ -21,48 +21,356 @@
 
 #include "bio/common/Random.h"
 
+#include <cmath>
+
+//@formatter:off
 #if BIO_CPP_VERSION >= 11
-	#include <random>
+	#include <atomic>
 #endif
+//@formatter:on
 
 namespace bio {
+namespace random {
+
+/**
+ * How far a Stream's state moves with each number (the SplitMix64 increment). <br />
+ */
+static const uint64_t sGamma = 0x9E3779B97F4A7C15ULL;
+
+/**
+ * Spreads stream ids across keys. <br />
+ */
+static const uint64_t sStreamMultiplier = 0xD1B54A32D192ED03ULL;
+
+/**
+ * How many numbers the Fill methods generate at once. <br />
+ */
+static const ::std::size_t sBlockSize = 64;
+
+static const double sTwoPi = 6.283185307179586476925286766559;
 
+//@formatter:off
 #if BIO_CPP_VERSION >= 11
-static ::std::random_device rd;
-static ::std::mt19937 gen(rd());
+	static ::std::atomic< uint64_t > sSeed(0);
+	static ::std::atomic< uint64_t > sNextThreadStream(0);
+#else
+	static uint64_t sSeed = 0;
 #endif
+//@formatter:on
+
+/**
+ * @param bits
+ * @return a double uniformly distributed in (0, 1].
+ */
+static inline double ToUnit(uint64_t bits)
+{
+	return static_cast< double >((bits >> 11) + 1) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * Make a pair of standard normals from a pair of uniforms (Box-Muller). <br />
+ */
+static inline void ToNormals(
+	double u1,
+	double u2,
+	float& z0,
+	float& z1
+)
+{
+	double radius = ::std::sqrt(-2.0 * ::std::log(u1));
+	double theta = sTwoPi * u2;
+	z0 = static_cast< float >(radius * ::std::cos(theta));
+	z1 = static_cast< float >(radius * ::std::sin(theta));
+}
+
+uint64_t Mix(uint64_t value)
+{
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+	return value ^ (value >> 31);
+}
+
+void SetSeed(uint64_t seed)
+{
+	sSeed = seed;
+}
+
+uint64_t GetSeed()
+{
+	return sSeed;
+}
+
+Stream::Stream(uint64_t streamId)
+{
+	Reset(
+		random::GetSeed(),
+		streamId
+	);
+}
+
+Stream::Stream(
+	uint64_t seed,
+	uint64_t streamId
+)
+{
+	Reset(
+		seed,
+		streamId
+	);
+}
+
+Stream::~Stream()
+{
+
+}
+
+void Stream::Reset(
+	uint64_t seed,
+	uint64_t streamId
+)
+{
+	mSeed = seed;
+	mKey = seed ^ (streamId * sStreamMultiplier);
+	mPosition = 0;
+	mSpareNormal = 0.0f;
+	mHasSpareNormal = false;
+}
+
+uint64_t Stream::Next()
+{
+	++mPosition;
+	return Mix(mKey + mPosition * sGamma);
+}
+
+void Stream::Skip(uint64_t count)
+{
+	mPosition += count;
+}
+
+uint64_t Stream::GetPosition() const
+{
+	return mPosition;
+}
+
+uint64_t Stream::GetSeed() const
+{
+	return mSeed;
+}
+
+double Stream::Uniform()
+{
+	return ToUnit(Next());
+}
+
+float Stream::UniformFloat(
+	float min,
+	float max
+)
+{
+	return min + (max - min) * static_cast< float >(Uniform());
+}
 
-float random::NormalFloat(
+float Stream::NormalFloat(
 	float mean,
 	float standardDeviation
 )
 {
-	#if BIO_CPP_VERSION >= 11
-	std::normal_distribution<float> dist
+	if (mHasSpareNormal)
+	{
+		mHasSpareNormal = false;
+		return mean + standardDeviation * mSpareNormal;
+	}
+	float ret;
+	double u1 = Uniform();
+	ToNormals(
+		u1,
+		Uniform(),
+		ret,
+		mSpareNormal
+	);
+	mHasSpareNormal = true;
+	return mean + standardDeviation * ret;
+}
+
+void Stream::FillUniform(
+	float* out,
+	::std::size_t count,
+	float min,
+	float max
+)
+{
+	const float range = max - min;
+	uint64_t bits[sBlockSize];
+	::std::size_t block;
+	::std::size_t idx;
+	while (count)
+	{
+		block = count < sBlockSize ? count : sBlockSize;
+
+		//Every number is independent of the others, so these loops can be vectorized.
+		for (
+			idx = 0;
+			idx < block;
+			++idx
+			)
+		{
+			bits[idx] = Mix(mKey + (mPosition + 1 + idx) * sGamma);
+		}
+		for (
+			idx = 0;
+			idx < block;
+			++idx
+			)
+		{
+			out[idx] = min + range * static_cast< float >(ToUnit(bits[idx]));
+		}
+
+		mPosition += block;
+		out += block;
+		count -= block;
+	}
+}
+
+void Stream::FillNormal(
+	float* out,
+	::std::size_t count,
+	float mean,
+	float standardDeviation
+)
+{
+	if (count && mHasSpareNormal)
+	{
+		*out++ = NormalFloat(
+			mean,
+			standardDeviation
+		);
+		--count;
+	}
+
+	uint64_t bits[sBlockSize];
+	float normals[sBlockSize];
+	::std::size_t pairs;
+	::std::size_t idx;
+	while (count > 1)
+	{
+		pairs = count / 2 < sBlockSize / 2 ? count / 2 : sBlockSize / 2;
+
+		for (
+			idx = 0;
+			idx < pairs * 2;
+			++idx
+			)
+		{
+			bits[idx] = Mix(mKey + (mPosition + 1 + idx) * sGamma);
+		}
+		for (
+			idx = 0;
+			idx < pairs;
+			++idx
+			)
 		{
+			ToNormals(
+				ToUnit(bits[idx * 2]),
+				ToUnit(bits[idx * 2 + 1]),
+				normals[idx * 2],
+				normals[idx * 2 + 1]
+			);
+		}
+		for (
+			idx = 0;
+			idx < pairs * 2;
+			++idx
+			)
+		{
+			out[idx] = mean + standardDeviation * normals[idx];
+		}
+
+		mPosition += pairs * 2;
+		out += pairs * 2;
+		count -= pairs * 2;
+	}
+
+	if (count)
+	{
+		*out = NormalFloat(
 			mean,
 			standardDeviation
-		};
-	return dist(gen);
+		);
+	}
+}
+
+Stream& GetThreadStream()
+{
+	//@formatter:off
+	#if BIO_CPP_VERSION >= 11
+		static thread_local uint64_t sStreamId = sNextThreadStream++;
+		static thread_local Stream sStream(random::GetSeed(), sStreamId);
 	#else
-	return 0;
+		static uint64_t sStreamId = 0;
+		static Stream sStream(random::GetSeed(), sStreamId);
 	#endif
+	//@formatter:on
+	if (sStream.GetSeed() != random::GetSeed())
+	{
+		sStream.Reset(
+			random::GetSeed(),
+			sStreamId
+		);
+	}
+	return sStream;
 }
 
-float random::UniformFloat(
+float NormalFloat(
+	float mean,
+	float standardDeviation
+)
+{
+	return GetThreadStream().NormalFloat(
+		mean,
+		standardDeviation
+	);
+}
+
+float UniformFloat(
 	float min,
 	float max
 )
 {
-	#if BIO_CPP_VERSION >= 11
-	std::uniform_real_distribution<float> dist(
+	return GetThreadStream().UniformFloat(
+		min,
+		max
+	);
+}
+
+void FillNormal(
+	float* out,
+	::std::size_t count,
+	float mean,
+	float standardDeviation
+)
+{
+	GetThreadStream().FillNormal(
+		out,
+		count,
+		mean,
+		standardDeviation
+	);
+}
+
+void FillUniform(
+	float* out,
+	::std::size_t count,
+	float min,
+	float max
+)
+{
+	GetThreadStream().FillUniform(
+		out,
+		count,
 		min,
 		max
 	);
-	return dist(gen);
-	#else
-	return 0;
-	#endif
 }
 
+} //random namespace
 } //bio namespace
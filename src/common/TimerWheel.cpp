@@ -0,0 +1,259 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2023 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "bio/common/TimerWheel.h"
+
+namespace bio {
+
+TimerWheel::TimerWheel(Timestamp now)
+	:
+	mNow(now),
+	mSlots(sLevels * sSlots),
+	mCount(0)
+{
+	for (
+		unsigned int lvl = 0;
+		lvl < sLevels;
+		++lvl
+		)
+	{
+		mLevelCounts[lvl] = 0;
+	}
+}
+
+TimerWheel::~TimerWheel()
+{
+
+}
+
+void TimerWheel::Schedule(
+	::std::size_t item,
+	Timestamp when
+)
+{
+	Place(Timer(when, item));
+}
+
+void TimerWheel::Advance(
+	Timestamp now,
+	Timers& expired
+)
+{
+	while (mNow < now)
+	{
+		if (!mCount)
+		{
+			mNow = now;
+			break;
+		}
+
+		//Skip straight to the next occupied slot of the lowest occupied level; nothing can expire before then.
+		unsigned int lowest = 0;
+		while (lowest < sLevels && !mLevelCounts[lowest])
+		{
+			++lowest;
+		}
+
+		Timestamp next;
+		if (lowest == sLevels)
+		{
+			//Only the overflow is occupied: jump to the block of the earliest overflowed Timer.
+			next = mOverflow[0].first;
+			for (
+				::std::size_t tmr = 1;
+				tmr < mOverflow.size();
+				++tmr
+				)
+			{
+				if (mOverflow[tmr].first < next)
+				{
+					next = mOverflow[tmr].first;
+				}
+			}
+			next = (next >> (sBits * sLevels)) << (sBits * sLevels);
+		}
+		else
+		{
+			::std::size_t slot = ((mNow >> (sBits * lowest)) & (sSlots - 1)) + 1;
+			while (slot < sSlots && GetSlot(lowest, slot).empty())
+			{
+				++slot;
+			}
+			BIO_SANITIZE(slot < sSlots, , break)
+			next = ((mNow >> (sBits * (lowest + 1))) << (sBits * (lowest + 1))) | (Timestamp(slot) << (sBits * lowest));
+		}
+
+		if (next > now)
+		{
+			mNow = now;
+			break;
+		}
+		mNow = next - 1;
+		Step();
+	}
+
+	expired.insert(
+		expired.end(),
+		mDue.begin(),
+		mDue.end());
+	mDue.clear();
+}
+
+void TimerWheel::Clear()
+{
+	for (
+		::std::size_t slt = 0;
+		slt < mSlots.size();
+		++slt
+		)
+	{
+		mSlots[slt].clear();
+	}
+	for (
+		unsigned int lvl = 0;
+		lvl < sLevels;
+		++lvl
+		)
+	{
+		mLevelCounts[lvl] = 0;
+	}
+	mOverflow.clear();
+	mDue.clear();
+	mCount = 0;
+}
+
+Timestamp TimerWheel::GetTime() const
+{
+	return mNow;
+}
+
+::std::size_t TimerWheel::GetNumberOfTimers() const
+{
+	return mCount + mDue.size();
+}
+
+void TimerWheel::Place(const Timer& timer)
+{
+	if (timer.first <= mNow)
+	{
+		mDue.push_back(timer);
+		return;
+	}
+	for (
+		unsigned int lvl = 0;
+		lvl < sLevels;
+		++lvl
+		)
+	{
+		if ((timer.first >> (sBits * (lvl + 1))) == (mNow >> (sBits * (lvl + 1))))
+		{
+			GetSlot(
+				lvl,
+				(timer.first >> (sBits * lvl)) & (sSlots - 1)
+			).push_back(timer);
+			++mLevelCounts[lvl];
+			++mCount;
+			return;
+		}
+	}
+	mOverflow.push_back(timer);
+	++mCount;
+}
+
+void TimerWheel::Step()
+{
+	++mNow;
+
+	Timers cascade;
+
+	//Cascade from the top down, so that Timers can fall through more than one level at once.
+	if (!(mNow & ((Timestamp(1) << (sBits * sLevels)) - 1)) && !mOverflow.empty())
+	{
+		cascade.swap(mOverflow);
+		mCount -= cascade.size();
+		for (
+			::std::size_t tmr = 0;
+			tmr < cascade.size();
+			++tmr
+			)
+		{
+			Place(cascade[tmr]);
+		}
+		cascade.clear();
+	}
+	for (
+		unsigned int lvl = sLevels - 1;
+		lvl > 0;
+		--lvl
+		)
+	{
+		if (mNow & ((Timestamp(1) << (sBits * lvl)) - 1))
+		{
+			continue;
+		}
+		Timers& slot = GetSlot(
+			lvl,
+			(mNow >> (sBits * lvl)) & (sSlots - 1)
+		);
+		if (slot.empty())
+		{
+			continue;
+		}
+		cascade.swap(slot);
+		mLevelCounts[lvl] -= cascade.size();
+		mCount -= cascade.size();
+		for (
+			::std::size_t tmr = 0;
+			tmr < cascade.size();
+			++tmr
+			)
+		{
+			Place(cascade[tmr]);
+		}
+		cascade.clear();
+	}
+
+	Timers& expiring = GetSlot(
+		0,
+		mNow & (sSlots - 1)
+	);
+	if (!expiring.empty())
+	{
+		mLevelCounts[0] -= expiring.size();
+		mCount -= expiring.size();
+		mDue.insert(
+			mDue.end(),
+			expiring.begin(),
+			expiring.end());
+		expiring.clear();
+	}
+}
+
+TimerWheel::Timers& TimerWheel::GetSlot(
+	unsigned int level,
+	::std::size_t slot
+)
+{
+	return mSlots[level * sSlots + slot];
+}
+
+} //bio namespace
@@ -21,31 +21,29 @@
 
 #include "bio/common/cache/AbstractCached.h"
 #include "bio/common/cache/Cache.h"
-#include "bio/common/thread/SafelyAccess.h"
 
 namespace bio {
 
 AbstractCached::AbstractCached()
+	:
+	mGeneration(GlobalCache::Instance().GetGeneration())
 {
-	Register(); //CAREFUL! This is NOT VIRTUAL!
+
 }
 
 AbstractCached::~AbstractCached()
 {
-	Deregister(); //CAREFUL! This is NOT VIRTUAL!
+
 }
 
-void AbstractCached::Register()
+bool AbstractCached::IsStale() const
 {
-	BIO_SANITIZE(!SafelyAccess<GlobalCache>()->Has(this), , return)
-	SafelyAccess<GlobalCache>()->Add(this);
+	return mGeneration != GlobalCache::Instance().GetGeneration();
 }
 
-void AbstractCached::Deregister()
+void AbstractCached::Refresh()
 {
-	Index indexOfThis = SafelyAccess<GlobalCache>()->SeekTo(this);
-	BIO_SANITIZE(indexOfThis, , return)
-	SafelyAccess<GlobalCache>()->Erase(indexOfThis);
+	mGeneration = GlobalCache::Instance().GetGeneration();
 }
 
 } //bio namespace
@@ -20,11 +20,12 @@
  */
 
 #include "bio/common/cache/Cache.h"
-#include "bio/common/cache/AbstractCached.h"
 
 namespace bio {
 
 Cache::Cache()
+	:
+	mGeneration(0)
 {
 
 }
@@ -36,14 +37,12 @@ Cache::~Cache()
 
 void Cache::Flush()
 {
-	for (
-		SmartIterator chd = End();
-		!chd.IsBeforeBeginning();
-		--chd
-		)
-	{
-		chd.As< AbstractCached* >()->Flush();
-	}
+	++mGeneration;
+}
+
+uint32_t Cache::GetGeneration() const
+{
+	return mGeneration;
 }
 
 } //bio namespace
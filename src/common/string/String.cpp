@@ -83,7 +83,7 @@ String::String(const char* string) :
 }
 
 String::String(::std::string string) :
-	ImmutableString(GetCloneOf(string.c_str()), strlen(mString)),
+	ImmutableString(GetCloneOf(string.c_str()), string.length()),
 	mMode(READ_WRITE)
 {
 
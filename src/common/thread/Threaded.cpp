@@ -26,6 +26,8 @@
 #if BIO_CPP_VERSION < 11
 	#ifdef BIO_OS_IS_LINUX
 		#include <unistd.h>
+		#include <sched.h>
+		#include <sys/syscall.h>
 	#endif
 #else
 	#include <chrono>
@@ -111,6 +113,34 @@ Threaded::ThreadId Threaded::GetThreadId()
 	//@formatter:on
 }
 
+/*static*/ Threaded::ThreadId Threaded::GetCurrentThreadId()
+{
+	//@formatter:off
+	#if BIO_CPP_VERSION < 11
+		#ifdef BIO_OS_IS_LINUX
+			return syscall(SYS_gettid);
+		#else
+			return InvalidThreadId();
+		#endif
+	#else
+		return ::std::this_thread::get_id();
+	#endif
+	//@formatter:on
+}
+
+/*static*/ void Threaded::YieldThread()
+{
+	//@formatter:off
+	#if BIO_CPP_VERSION < 11
+		#ifdef BIO_OS_IS_LINUX
+			sched_yield();
+		#endif
+	#else
+		::std::this_thread::yield();
+	#endif
+	//@formatter:on
+}
+
 bool Threaded::Start()
 {
 	LockThread();
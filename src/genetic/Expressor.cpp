@@ -21,6 +21,7 @@
 
 #include "bio/genetic/Expressor.h"
 #include "bio/genetic/Plasmid.h"
+#include "bio/genetic/Proteome.h"
 #include "bio/genetic/common/Codes.h"
 
 namespace bio {
@@ -36,6 +37,63 @@ Code Expressor::Apoptose()
 	return code::NotImplemented();
 }
 
+molecular::Protein* Expressor::ShareDefaultProtein(const Name& name)
+{
+	return Covalent< chemical::LinearMotif< molecular::Protein* > >::Object()->ShareImplementation(SafelyAccess< Proteome >()->GetDefault(name));
+}
+
+molecular::Protein* Expressor::ShareDefaultProtein(const Id& proteinId)
+{
+	return Covalent< chemical::LinearMotif< molecular::Protein* > >::Object()->ShareImplementation(SafelyAccess< Proteome >()->GetDefault(proteinId));
+}
+
+molecular::Protein* Expressor::ExpressProtein(
+	molecular::Protein*& slot,
+	const Id& proteinId,
+	bool shared
+)
+{
+	if (slot)
+	{
+		return slot;
+	}
+
+	chemical::LinearMotif< molecular::Protein* >* proteins = Covalent< chemical::LinearMotif< molecular::Protein* > >::Object();
+	physical::Line* contents = Cast< physical::Line* >(proteins->GetAllImplementation());
+	Index found = contents->SeekToId(proteinId);
+	if (found)
+	{
+		slot = ChemicalCast< molecular::Protein* >(contents->LinearAccess(found));
+	}
+	else if (shared)
+	{
+		slot = ShareDefaultProtein(proteinId);
+	}
+	else
+	{
+		slot = proteins->AddImplementation(new molecular::Protein(proteinId));
+	}
+	return slot;
+}
+
+molecular::Protein* Expressor::CustomizeProtein(const Id& proteinId)
+{
+	chemical::LinearMotif< molecular::Protein* >* proteins = Covalent< chemical::LinearMotif< molecular::Protein* > >::Object();
+	if (!proteins->IsSharedImplementation(proteinId))
+	{
+		return proteins->GetByIdImplementation(proteinId);
+	}
+	molecular::Protein* ret = proteins->UnshareImplementation(proteinId);
+	BIO_SANITIZE(ret, , return NULL)
+	CacheProteins();
+	return ret;
+}
+
+molecular::Protein* Expressor::CustomizeProtein(const Name& proteinName)
+{
+	return CustomizeProtein(SafelyAccess<IdPerspective>()->GetIdWithoutCreation(proteinName));
+}
+
 Code Expressor::Activate(const Id& proteinId)
 {
 	Code ret = code::Success();
@@ -95,6 +153,9 @@ Code Expressor::Translate(const RNA* mRNA)
 
 	Code ret = code::Success();
 
+	//Genes may Unshare our Proteins (see Localization::SeekToWrite()), which would leave our cached Proteins dangling.
+	chemical::Revision proteinRevision = Covalent< chemical::LinearMotif< molecular::Protein* > >::Object()->GetRevisionImplementation();
+
 	Gene* gene;
 	for (
 		SmartIterator rna = mTranscriptome.Begin();
@@ -115,6 +176,10 @@ Code Expressor::Translate(const RNA* mRNA)
 			}
 		}
 	}
+	if (Covalent< chemical::LinearMotif< molecular::Protein* > >::Object()->GetRevisionImplementation() != proteinRevision)
+	{
+		CacheProteins();
+	}
 	return ret;
 }
 
@@ -61,7 +61,8 @@ Id GenomeImplementation::RegisterPlasmid(Plasmid* toRegister)
 	if (mcRegisterPlasmid->Activate() == code::Success())
 	{
 		ret = toRegister->GetId();
-		BIO_SANITIZE(ret == mcRegisterPlasmid->RotateTo(mcRegistrationSite)->Probe< Plasmid >().GetId(),,)
+		const molecular::Surface* registrationSite = mcRegisterPlasmid->RotateTo(mcRegistrationSite);
+		BIO_SANITIZE(ret == registrationSite->Probe< Plasmid >().GetId(),,)
 	}
 	return ret;
 }
@@ -0,0 +1,80 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "bio/genetic/Proteome.h"
+
+namespace bio {
+namespace genetic {
+
+ProteomeImplementation::ProteomeImplementation()
+{
+
+}
+
+ProteomeImplementation::~ProteomeImplementation()
+{
+	LockThread();
+	for (
+		Defaults::iterator def = mDefaults.begin();
+		def != mDefaults.end();
+		++def
+		)
+	{
+		delete def->second;
+	}
+	mDefaults.clear();
+	UnlockThread();
+}
+
+molecular::Protein* ProteomeImplementation::GetDefault(const Name& name)
+{
+	return GetDefault(IdPerspective::Instance().GetIdFromName(name));
+}
+
+molecular::Protein* ProteomeImplementation::GetDefault(const Id& id)
+{
+	LockThread();
+	Defaults::iterator found = mDefaults.find(id);
+	molecular::Protein* ret;
+	if (found == mDefaults.end())
+	{
+		ret = new molecular::Protein(id);
+		mDefaults.insert(::std::make_pair(id, ret));
+	}
+	else
+	{
+		ret = found->second;
+	}
+	UnlockThread();
+	return ret;
+}
+
+::std::size_t ProteomeImplementation::GetNumberOfDefaults() const
+{
+	LockThread();
+	::std::size_t ret = mDefaults.size();
+	UnlockThread();
+	return ret;
+}
+
+} //genetic namespace
+} //bio namespace
@@ -40,6 +40,7 @@ Insertion::Insertion(
 	),
 	mToInsert(toInsert)
 {
+	mEpitope = epitope::Insert();
 	SetLocation(location); //virtual means nothing to ctors; do it again.
 }
 
@@ -50,7 +51,7 @@ Insertion::~Insertion()
 
 chemical::Substance* Insertion::Seek(chemical::Substance* insertIn) const
 {
-	insertIn = ResolvePrevious(insertIn);
+	insertIn = ResolvePreviousToWrite(insertIn);
 
 	BIO_SANITIZE(insertIn && mToInsert, , return insertIn);
 
@@ -59,32 +60,33 @@ chemical::Substance* Insertion::Seek(chemical::Substance* insertIn) const
 		return insertIn;
 	}
 
-	BIO_SANITIZE(mcMethod, , return NULL)
+	chemical::ExcitationBase* method = GetMethod();
+	BIO_SANITIZE(method, , return NULL)
 
 	ByteStream insertion(mToInsert);
-	(const_cast< chemical::ExcitationBase* >(mcMethod))->EditArg(
+	method->EditArg(
 		0,
 		insertion
 	);
 	ByteStream result;
-	mcMethod->CallDown(
+	method->CallDown(
 		insertIn->AsWave(),
-		result
+		&result
 	);
 	chemical::Substance* insert = ChemicalCast< chemical::Substance* >(Cast< physical::Wave* >(result.DirectAccess())); //This is about as safe as we can get right now.
 	BIO_SANITIZE(insert, , return NULL)
 	return insert;
 }
 
+chemical::Substance* Insertion::SeekToWrite(chemical::Substance* insertIn) const
+{
+	return Seek(insertIn);
+}
+
 void Insertion::SetLocation(Location location)
 {
-	//Assume Locations & Locations always match exactly.
-	mLocation = location;
-	if (mcMethod)
-	{
-		delete mcMethod;
-	}
-	mcMethod = SafelyAccess< Translocator >()->GetPeptidase(mLocation, "Insert");
+	//Our "Insert" mEpitope was set in the ctor, so the rest is the same as any other Localization.
+	Localization::SetLocation(location);
 }
 
 void Insertion::InsertThis(chemical::Substance* toInsert)
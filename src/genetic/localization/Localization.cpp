@@ -33,7 +33,14 @@ Localization::Localization(
 )
 	:
 	physical::Class< Localization >(this),
-	mcMethod(NULL)
+	mEpitope(epitope::Move()),
+	mcMethod(NULL),
+	mcUnshareMethod(NULL),
+	mcRevisionMethod(NULL),
+	mIsCompiled(false),
+	mcSoughtIn(NULL),
+	mcSought(NULL),
+	mcRevision(0)
 {
 	SetNameOfLocation(name);
 	SetLocation(location);
@@ -46,6 +53,11 @@ Localization::~Localization()
 		delete mcMethod;
 		mcMethod = NULL;
 	}
+	if (mcUnshareMethod)
+	{
+		delete mcUnshareMethod;
+		mcUnshareMethod = NULL;
+	}
 }
 
 chemical::Substance* Localization::ResolvePrevious(chemical::Substance* seekIn) const
@@ -63,6 +75,20 @@ chemical::Substance* Localization::ResolvePrevious(chemical::Substance* seekIn)
 	return seekIn;
 }
 
+chemical::Substance* Localization::ResolvePreviousToWrite(chemical::Substance* seekIn) const
+{
+	BIO_SANITIZE(seekIn, ,
+		return seekIn);
+
+	Localization* previous = ForceCast< Localization* >(Demodulate());
+
+	if (previous)
+	{
+		seekIn = previous->SeekToWrite(seekIn);
+	}
+	return seekIn;
+}
+
 chemical::Substance* Localization::Seek(chemical::Substance* seekIn) const
 {
 	seekIn = ResolvePrevious(seekIn);
@@ -74,25 +100,142 @@ chemical::Substance* Localization::Seek(chemical::Substance* seekIn) const
 		return seekIn;
 	}
 
-	BIO_SANITIZE(mcMethod, , return NULL)
+	chemical::Revision revision = 0;
+	if (mIsCompiled)
+	{
+		revision = GetRevisionOf(seekIn);
+		if (mcSought && seekIn == mcSoughtIn && revision == mcRevision)
+		{
+			return mcSought;
+		}
+	}
+
+	chemical::ExcitationBase* method = GetMethod();
+	BIO_SANITIZE(method, , return NULL)
 	ByteStream newName(mName);
-	(const_cast< chemical::ExcitationBase* >(mcMethod))->EditArg(
+	method->EditArg(
 		0,
 		newName
 	);
 	ByteStream result;
-	mcMethod->CallDown(
+	method->CallDown(
 		seekIn->AsWave(),
-		result
+		&result
 	);
 	chemical::Substance* extract = ChemicalCast< chemical::Substance* >(Cast< physical::Wave* >(result.DirectAccess())); //This is about as safe as we can get right now. 
 	BIO_SANITIZE(extract, , return NULL)
+
+	if (mIsCompiled && revision)
+	{
+		mcSoughtIn = seekIn;
+		mcSought = extract;
+		mcRevision = revision;
+	}
 	return extract;
 }
 
+chemical::Substance* Localization::SeekToWrite(chemical::Substance* seekIn) const
+{
+	seekIn = ResolvePreviousToWrite(seekIn);
+
+	BIO_SANITIZE(seekIn, , return seekIn);
+
+	if (mLocation == Translocator::InvalidId())
+	{
+		return seekIn;
+	}
+
+	//Nothing is cached here: Unsharing changes the Revision of what we Seek through anyway.
+	chemical::ExcitationBase* method = GetUnshareMethod();
+	BIO_SANITIZE(method, , return NULL)
+	ByteStream newName(mName);
+	method->EditArg(
+		0,
+		newName
+	);
+	ByteStream result;
+	method->CallDown(
+		seekIn->AsWave(),
+		&result
+	);
+	chemical::Substance* extract = ChemicalCast< chemical::Substance* >(Cast< physical::Wave* >(result.DirectAccess()));
+	BIO_SANITIZE(extract, , return NULL)
+	return extract;
+}
+
+chemical::Revision Localization::GetRevisionOf(chemical::Substance* seekIn) const
+{
+	BIO_SANITIZE(seekIn && mcRevisionMethod, , return 0)
+	ByteStream result;
+	mcRevisionMethod->CallDown(
+		seekIn->AsWave(),
+		&result
+	);
+	BIO_SANITIZE(result.Is< chemical::Revision >(), , return 0)
+	return result.As< chemical::Revision >();
+}
+
+chemical::ExcitationBase* Localization::GetMethod() const
+{
+	if (!mcMethod && mLocation != Translocator::InvalidId())
+	{
+		mcMethod = SafelyAccess< Translocator >()->ClonePeptidase(
+			mLocation,
+			mEpitope
+		);
+	}
+	return mcMethod;
+}
+
+chemical::ExcitationBase* Localization::GetUnshareMethod() const
+{
+	if (!mcUnshareMethod && mLocation != Translocator::InvalidId())
+	{
+		mcUnshareMethod = SafelyAccess< Translocator >()->ClonePeptidase(
+			mLocation,
+			epitope::Unshare()
+		);
+	}
+	return mcUnshareMethod;
+}
+
+void Localization::ClearCompilation() const
+{
+	mcSoughtIn = NULL;
+	mcSought = NULL;
+	mcRevision = 0;
+}
+
+void Localization::Compile()
+{
+	mIsCompiled = true;
+	Localization* previous = ForceCast< Localization* >(Demodulate());
+	if (previous)
+	{
+		previous->Compile();
+	}
+}
+
+void Localization::Decompile()
+{
+	mIsCompiled = false;
+	ClearCompilation();
+	Localization* previous = ForceCast< Localization* >(Demodulate());
+	if (previous)
+	{
+		previous->Decompile();
+	}
+}
+
+bool Localization::IsCompiled() const
+{
+	return mIsCompiled;
+}
+
 void Localization::SetNameOfLocation(const Name& name)
 {
 	mName = name;
+	ClearCompilation();
 }
 
 Name Localization::GetNameOfLocation() const
@@ -106,9 +249,22 @@ void Localization::SetLocation(Location location)
 	if (mcMethod)
 	{
 		delete mcMethod;
-		mcMethod = NULL;
+		mcMethod = NULL; //will be cloned by GetMethod().
+	}
+	if (mcUnshareMethod)
+	{
+		delete mcUnshareMethod;
+		mcUnshareMethod = NULL; //will be cloned by GetUnshareMethod().
+	}
+	mcRevisionMethod = NULL;
+	if (mLocation != Translocator::InvalidId())
+	{
+		mcRevisionMethod = SafelyAccess< Translocator >()->GetPeptidase(
+			mLocation,
+			epitope::Revision()
+		);
 	}
-	mcMethod = SafelyAccess< Translocator >()->GetPeptidase(mLocation, "Move");
+	ClearCompilation();
 }
 
 Location Localization::GetLocation() const
@@ -51,17 +51,20 @@ Code FetchPlasmid::Activate()
 
 	RotateTo(mcReturnSite)->Release();
 
-	Name& boundName = RotateTo(mcNameSite)->Probe< Name >();
-	Id& boundId = RotateTo(mcIdSite)->Probe< Id >();
+	//Only read, so that nothing shared is Cloned (see Surface::Probe()).
+	const molecular::Surface* nameSite = RotateTo(mcNameSite);
+	const molecular::Surface* idSite = RotateTo(mcIdSite);
+	const Name& boundName = nameSite->Probe< Name >();
+	Id boundId = idSite->Probe< Id >();
 
 	Plasmid* boundPlasmid = NULL;
 	if (boundName)
 	{
-		boundPlasmid = SafelyAccess<PlasmidPerspective>()->GetTypeFromNameAs< Plasmid* >(boundName);
+		boundPlasmid = PlasmidPerspective::Instance().GetTypeFromNameAs< Plasmid* >(boundName);
 	}
 	else if (boundId)
 	{
-		boundPlasmid = SafelyAccess<PlasmidPerspective>()->GetTypeFromIdAs< Plasmid* >(boundId);
+		boundPlasmid = PlasmidPerspective::Instance().GetTypeFromIdAs< Plasmid* >(boundId);
 	}
 
 	if (boundPlasmid)
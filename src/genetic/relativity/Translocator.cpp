@@ -27,12 +27,32 @@ namespace genetic {
 
 TranslocatorImplementation::TranslocatorImplementation()
 {
-    
+	for (
+		unsigned int loc = 0;
+		loc < sPeptidaseTableSize;
+		++loc
+		)
+	{
+		mPeptidaseTable[loc] = NULL;
+	}
 }
+
 TranslocatorImplementation::~TranslocatorImplementation()
 {
-    
+	for (
+		unsigned int loc = 0;
+		loc < sPeptidaseTableSize;
+		++loc
+		)
+	{
+		if (mPeptidaseTable[loc])
+		{
+			delete[] mPeptidaseTable[loc];
+			mPeptidaseTable[loc] = NULL;
+		}
+	}
 }
+
 bool TranslocatorImplementation::AssociateSignalPeptidase(
 	Location location,
 	Epitope epitope,
@@ -43,7 +63,15 @@ bool TranslocatorImplementation::AssociateSignalPeptidase(
 	SignalPeptide* signal = GetBraneAs< SignalPeptide* >(location);
 	BIO_SANITIZE(signal,,return false)
 	Epitope peptidaseId = signal->mPeptidases.GetIdFromName(SafelyAccess< EpitopePerspective >()->GetNameFromId(epitope));
-	return signal->mPeptidases.AssociateType(peptidaseId, peptidase->AsWave());
+	if (!signal->mPeptidases.AssociateType(peptidaseId, peptidase->AsWave()))
+	{
+		return false;
+	}
+	signal->mExcitations[peptidaseId] = peptidase;
+	PeptidaseEntry& entry = AccessPeptidaseTable(location, epitope);
+	entry.mPeptidase = peptidase;
+	entry.mIsKnown = true;
+	return true;
 }
 
 bool TranslocatorImplementation::DisassociateSignalPeptidase(
@@ -54,21 +82,29 @@ bool TranslocatorImplementation::DisassociateSignalPeptidase(
 	SignalPeptide* signal = GetBraneAs< SignalPeptide* >(location);
 	BIO_SANITIZE(signal,,return false)
 	Epitope peptidaseId = signal->mPeptidases.GetIdFromName(SafelyAccess< EpitopePerspective >()->GetNameFromId(epitope));
+	PeptidaseEntry& entry = AccessPeptidaseTable(location, epitope);
+	entry.mPeptidase = NULL; //Forget the Peptidase before it is deleted.
+	entry.mIsKnown = true;
+	signal->mExcitations.erase(peptidaseId);
 	return signal->mPeptidases.DisassociateType(peptidaseId);
 }
 
-chemical::ExcitationBase* TranslocatorImplementation::GetPeptidase(
+const chemical::ExcitationBase* TranslocatorImplementation::GetPeptidase(
 	Location location,
 	Epitope epitope
 )
 {
-    SignalPeptide* signal = GetBraneAs< SignalPeptide* >(location);
-	BIO_SANITIZE(signal,,return NULL)
-	Epitope peptidaseId = signal->mPeptidases.GetIdFromName(SafelyAccess< EpitopePerspective >()->GetNameFromId(epitope));
-	return signal->mPeptidases.template GetNewObjectFromIdAs< chemical::ExcitationBase* >(peptidaseId);
+	BIO_SANITIZE(location != InvalidId() && epitope != EpitopePerspective::InvalidId(),,return NULL)
+	PeptidaseEntry& entry = AccessPeptidaseTable(location, epitope);
+	if (!entry.mIsKnown)
+	{
+		entry.mPeptidase = FindPeptidase(location, epitope);
+		entry.mIsKnown = true;
+	}
+	return entry.mPeptidase;
 }
 
-chemical::ExcitationBase* TranslocatorImplementation::GetPeptidase(
+const chemical::ExcitationBase* TranslocatorImplementation::GetPeptidase(
 	Location location,
 	const Name& epitope
 )
@@ -76,6 +112,63 @@ chemical::ExcitationBase* TranslocatorImplementation::GetPeptidase(
 	return GetPeptidase(location, EpitopePerspective::Instance().GetIdFromName(epitope));
 }
 
+chemical::ExcitationBase* TranslocatorImplementation::ClonePeptidase(
+	Location location,
+	Epitope epitope
+)
+{
+	const chemical::ExcitationBase* peptidase = GetPeptidase(location, epitope);
+	BIO_SANITIZE(peptidase,,return NULL)
+	return peptidase->CloneExcitation();
+}
+
+chemical::ExcitationBase* TranslocatorImplementation::ClonePeptidase(
+	Location location,
+	const Name& epitope
+)
+{
+	return ClonePeptidase(location, EpitopePerspective::Instance().GetIdFromName(epitope));
+}
+
+const chemical::ExcitationBase* TranslocatorImplementation::FindPeptidase(
+	Location location,
+	Epitope epitope
+)
+{
+	SignalPeptide* signal = GetBraneAs< SignalPeptide* >(location);
+	BIO_SANITIZE(signal,,return NULL)
+	Epitope peptidaseId = signal->mPeptidases.GetIdWithoutCreation(SafelyAccess< EpitopePerspective >()->GetNameFromId(epitope));
+	BIO_SANITIZE(peptidaseId,,return NULL)
+	::std::map< Epitope, chemical::ExcitationBase* >::const_iterator found = signal->mExcitations.find(peptidaseId);
+	if (found == signal->mExcitations.end())
+	{
+		return NULL;
+	}
+	return found->second;
+}
+
+TranslocatorImplementation::PeptidaseEntry& TranslocatorImplementation::AccessPeptidaseTable(
+	Location location,
+	Epitope epitope
+)
+{
+	PeptidaseEntry*& row = mPeptidaseTable[location];
+	if (!row)
+	{
+		row = new PeptidaseEntry[sPeptidaseTableSize];
+		for (
+			unsigned int ept = 0;
+			ept < sPeptidaseTableSize;
+			++ept
+			)
+		{
+			row[ept].mPeptidase = NULL;
+			row[ept].mIsKnown = false;
+		}
+	}
+	return row[epitope];
+}
+
 physical::Brane< Location >* TranslocatorImplementation::CreateBrane(Location id, const Name& name)
 {
     return new SignalPeptide(id, name);
@@ -24,6 +24,7 @@
 //
 
 #include "bio/molecular/Pathway.h"
+#include "bio/chemical/common/Codes.h"
 
 namespace bio {
 namespace molecular {
@@ -33,29 +34,38 @@ Pathway::~Pathway()
 
 }
 
-chemical::Products Pathway::Process(chemical::Reactants* reactants)
+chemical::Products Pathway::Process(chemical::Reactants* reactants) const
 {
 	BIO_SANITIZE(reactants, ,
 		return code::BadArgument1())
+	if (!IsCompiled() && Compile() != code::Success())
+	{
+		return code::FailedReaction();
+	}
 
 	chemical::Products products(reactants);
-	Reaction* reaction;
+	chemical::Reactants intermediates;
+	chemical::Reactants* next = reactants; //the first step uses the given reactants directly.
 	for (
-		SmartIterator rct = GetAll< Reaction* >()->Begin();
-		!rct.IsAfterEnd();
-		++rct
+		::std::size_t stp = 0;
+		stp < mSteps.size();
+		++stp
 		)
 	{
-		if (products == code::Success() && products != code::NoErrorNoSuccess())
+		if (!(products == code::Success()) || products == code::NoErrorNoSuccess())
 		{
-			chemical::Reactants nextReactants(products);
-			reaction = rct;
-			products = (*reaction)(&nextReactants);
+			break;
+		}
+		if (mCheckSteps[stp])
+		{
+			products = (*mSteps[stp])(next);
 		}
 		else
 		{
-			break;
+			products = mSteps[stp]->Process(next);
 		}
+		intermediates.Replace(products.GetSubstances());
+		next = &intermediates;
 	}
 	return products;
 }
@@ -67,5 +77,59 @@ bool Pathway::ReactantsMeetRequirements(const chemical::Reactants* toCheck) cons
 	return GetAll< chemical::Reaction* >()->Begin().As< chemical::Reaction* >()->ReactantsMeetRequirements(toCheck);
 }
 
+bool Pathway::HasRequirements() const
+{
+	if (!GetCount< chemical::Reaction* >())
+	{
+		return true; //we can't Process anything.
+	}
+	return GetAll< chemical::Reaction* >()->Begin().As< chemical::Reaction* >()->HasRequirements();
+}
+
+Code Pathway::Compile() const
+{
+	mSteps.clear();
+	mCheckSteps.clear();
+	mCompiledFor = NULL;
+	mCompiledRevision = 0;
+
+	const Container* reactions = GetAll< chemical::Reaction* >();
+	BIO_SANITIZE(reactions, , return code::BadArgument1())
+	mSteps.reserve(reactions->GetNumberOfElements());
+	mCheckSteps.reserve(reactions->GetNumberOfElements());
+
+	const chemical::Reaction* reaction;
+	for (
+		SmartIterator rct = reactions->Begin();
+		!rct.IsAfterEnd();
+		++rct
+		)
+	{
+		reaction = rct.As< chemical::Reaction* >();
+		if (!reaction || reaction == this)
+		{
+			mSteps.clear();
+			mCheckSteps.clear();
+			return code::BadArgument1();
+		}
+		mSteps.push_back(reaction);
+		mCheckSteps.push_back(reaction->HasRequirements());
+	}
+	mCompiledFor = this;
+	mCompiledRevision = GetRevision< chemical::Reaction* >();
+	return code::Success();
+}
+
+void Pathway::CommonConstructor()
+{
+	mCompiledFor = NULL;
+	mCompiledRevision = 0;
+}
+
+bool Pathway::IsCompiled() const
+{
+	return mCompiledFor == this && mCompiledRevision == GetRevision< chemical::Reaction* >();
+}
+
 } //molecular namespace
 } //bio namespace
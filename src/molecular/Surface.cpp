@@ -24,6 +24,8 @@
 #include "bio/molecular/common/Filters.h"
 #include "bio/molecular/common/SymmetryTypes.h"
 
+#include <vector>
+
 namespace bio {
 namespace molecular {
 
@@ -33,7 +35,8 @@ Surface::Surface() :
 		filter::Molecular(),
 		symmetry_type::Value()),
 	EnvironmentDependent< Molecule* >(NULL),
-	mBoundPosition(InvalidIndex())
+	mBoundPosition(InvalidIndex()),
+	mShareCount(NULL)
 {
 
 }
@@ -50,7 +53,8 @@ Surface::Surface(
 		filter::Molecular(),
 		symmetry_type::Value()),
 	chemical::EnvironmentDependent< Molecule* >(environment),
-	mBoundPosition(InvalidIndex())
+	mBoundPosition(InvalidIndex()),
+	mShareCount(NULL)
 {
 
 }
@@ -63,9 +67,11 @@ Surface::Surface(const Surface& toCopy)
 		toCopy.GetFilter(),
 		symmetry_type::Value()),
 	chemical::EnvironmentDependent< Molecule* >(toCopy),
-	mBoundPosition(toCopy.mBoundPosition)
+	mBoundPosition(toCopy.mBoundPosition),
+	mShareCount(NULL)
 {
 	chemical::Bond* bond;
+	bool managing = false;
 	for (
 		SmartIterator bnd = toCopy.mBonds.End();
 		!bnd.IsBeforeBeginning();
@@ -76,16 +82,33 @@ Surface::Surface(const Surface& toCopy)
 		if (bond->GetType() == bond_type::Manage())
 		{
 			//Calling FormBondImplementation directly saves us some work and should be safer than trying to do auto-template type determination from Clone().
+			//We share toCopy's Waves until one of us changes them (see Unshare()).
 			FormBondImplementation(
-				bond->GetBonded()->Clone(),
+				bond->GetBonded(),
 				bond->GetId(),
 				bond->GetType());
+			managing = true;
 		}
 	}
+
+	if (managing)
+	{
+		//Lock so that 2 copies of toCopy made at once get the same count.
+		toCopy.LockThread();
+		if (!toCopy.mShareCount)
+		{
+			toCopy.mShareCount = new ShareCount(1);
+		}
+		++*toCopy.mShareCount;
+		mShareCount = toCopy.mShareCount;
+		toCopy.UnlockThread();
+	}
 }
 
 Surface::~Surface()
 {
+	//Decide whether we are the last holder before deleting anything, so that 2 sharers destroyed at once can't both keep (or both delete) the Waves.
+	bool shared = DropShare();
 	chemical::Bond* bond;
 	for (
 		SmartIterator bnd = mBonds.End();
@@ -97,12 +120,77 @@ Surface::~Surface()
 		if (bond->GetType() == bond_type::Manage())
 		{
 			//bypass BreakBondImplementation and just do it.
-			delete bond->GetBonded();
+			if (!shared)
+			{
+				delete bond->GetBonded();
+			}
 			bond->Break();
 		}
 	}
 }
 
+bool Surface::DropShare()
+{
+	if (!mShareCount)
+	{
+		return false;
+	}
+	ShareCount* count = mShareCount;
+	mShareCount = NULL;
+	if (--*count) //atomic decrement and test, where available.
+	{
+		return true;
+	}
+	delete count;
+	return false;
+}
+
+void Surface::Unshare()
+{
+	if (!mShareCount)
+	{
+		return;
+	}
+	if (*mShareCount == 1)
+	{
+		//Everyone we shared with is gone and, since we hold 1, no one else can drop the last.
+		DropShare();
+		return;
+	}
+
+	//Clone before letting go, since the others may delete the originals as soon as we do.
+	::std::vector< physical::Wave* > originals;
+	chemical::Bond* bond;
+	for (
+		SmartIterator bnd = mBonds.End();
+		!bnd.IsBeforeBeginning();
+		--bnd
+		)
+	{
+		bond = bnd;
+		if (bond->GetType() == bond_type::Manage())
+		{
+			originals.push_back(bond->GetBonded());
+			bond->Form(
+				bond->GetId(),
+				bond->GetBonded()->Clone(),
+				bond->GetType());
+		}
+	}
+	if (!DropShare())
+	{
+		//The others let go while we were Cloning, so the originals are ours to delete.
+		for (
+			::std::vector< physical::Wave* >::iterator org = originals.begin();
+			org != originals.end();
+			++org
+			)
+		{
+			delete *org;
+		}
+	}
+}
+
 void Surface::SetEnvironment(Molecule* environment)
 {
 	this->chemical::EnvironmentDependent< Molecule* >::SetEnvironment(environment);
@@ -125,6 +213,7 @@ physical::Wave* Surface::Release(
 	BondType bondType
 )
 {
+	Unshare();
 	physical::Wave* ret = NULL;
 	chemical::Bond* bond;
 	for (
@@ -155,6 +244,7 @@ chemical::Substance* Surface::Release(
 	BondType bondType
 )
 {
+	Unshare();
 	chemical::Substance* ret = NULL;
 	chemical::Bond* bond;
 	for (
@@ -187,6 +277,7 @@ chemical::Substance* Surface::Release(
 	BondType bondType
 )
 {
+	Unshare();
 	chemical::Substance* ret = NULL;
 	chemical::Bond* bond;
 	for (
@@ -215,6 +306,7 @@ chemical::Substance* Surface::Release(
 
 physical::Waves Surface::Release(BondType bondType)
 {
+	Unshare();
 	physical::Waves ret;
 	chemical::Bond* bond;
 	for (
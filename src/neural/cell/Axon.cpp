@@ -25,37 +25,71 @@
 namespace bio {
 namespace neural {
 
-Axon::~Axon()
+/**
+ * Protein slots; see genetic::Expressor::ExpressProtein(). <br />
+ * Ids are looked up on first use rather than during static initialization, when the IdPerspective may not exist yet. <br />
+ */
+static Id ProcessOutgoingId()
+{
+	static Id id = IdPerspective::Instance().GetIdFromName("ProcessOutgoing");
+	return id;
+}
+
+static Id CallbackId()
+{
+	static Id id = IdPerspective::Instance().GetIdFromName("Callback");
+	return id;
+}
+
+static Id DepotentiateSignalId()
 {
+	static Id id = IdPerspective::Instance().GetIdFromName("DepotentiateSignal");
+	return id;
+}
+
+void Axon::CommonConstructor()
+{
+	mcProcessOutgoing = NULL;
+	mCallback = NULL;
+	mcDepotentiateSignal = NULL;
+}
 
+Axon::~Axon()
+{
+	if (mSheath.mGlia)
+	{
+		mSheath.mGlia->Forget(this);
+	}
 }
 
 Code Axon::CacheProteins()
 {
-	mcProcessOutgoing = GetByName< molecular::Protein* >("ProcessOutgoing");
-	mCallback = GetByName< molecular::Protein* >("Callback");
-	mcDepotentiateSignal = GetByName< molecular::Protein* >("DepotentiateSignal");
+	//Slots are filled by Id on their next use.
+	mcProcessOutgoing = NULL;
+	mCallback = NULL;
+	mcDepotentiateSignal = NULL;
 	
 	return Neurite::CacheProteins();
 }
 
 Code Axon::CreateDefaultProteins()
 {
-	Add< molecular::Protein* >(new molecular::Protein("ProcessOutgoing"));
-	Add< molecular::Protein* >(new molecular::Protein("Callback"));
-	Add< molecular::Protein* >(new molecular::Protein("DepotentiateSignal"));
+	ExpressProtein(mcProcessOutgoing, ProcessOutgoingId());
+	ExpressProtein(mCallback, CallbackId(), false); //Bound during use, so not shared.
+	ExpressProtein(mcDepotentiateSignal, DepotentiateSignalId());
 	
 	return Neurite::CreateDefaultProteins();
 }
 
 Code Axon::ProcessOutgoing()
 {
-	return (*mcProcessOutgoing)();
+	return (*ExpressProtein(mcProcessOutgoing, ProcessOutgoingId()))();
 }
 
 void Axon::Callback(const molecular::Molecule* arg)
 {
 	static Id bindingSite = IdPerspective::Instance().GetIdFromName("PostsynapticCallback");
+	ExpressProtein(mCallback, CallbackId(), false);
 	if (arg)
 	{
 		mCallback->RotateTo(bindingSite)->Bind(*arg);
@@ -91,7 +125,7 @@ void Axon::Update(Timestamp addDatumAt)
 
 void Axon::DepotentiateSignal()
 {
-	(*mcDepotentiateSignal)();
+	(*ExpressProtein(mcDepotentiateSignal, DepotentiateSignalId()))();
 }
 
 const Neuron* Axon::GetPresynapticNeuron() const
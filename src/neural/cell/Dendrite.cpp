@@ -22,40 +22,103 @@
 #include "bio/neural/cell/Dendrite.h"
 #include "bio/neural/cell/Neuron.h"
 
+#include <limits>
+
 namespace bio {
 namespace neural {
 
-Dendrite::~Dendrite()
+/**
+ * Protein slots; see genetic::Expressor::ExpressProtein(). <br />
+ * Ids are looked up on first use rather than during static initialization, when the IdPerspective may not exist yet. <br />
+ */
+static Id PrepareForPotentiationId()
+{
+	static Id id = IdPerspective::Instance().GetIdFromName("PrepareForPotentiation");
+	return id;
+}
+
+static Id ProcessPotentiationId()
 {
+	static Id id = IdPerspective::Instance().GetIdFromName("ProcessPotentiation");
+	return id;
+}
 
+static Id PostPotentiationId()
+{
+	static Id id = IdPerspective::Instance().GetIdFromName("PostPotentiation");
+	return id;
+}
+
+static Id PrepareForDepotentiationId()
+{
+	static Id id = IdPerspective::Instance().GetIdFromName("PrepareForDepotentiation");
+	return id;
+}
+
+static Id ProcessDepotentiationId()
+{
+	static Id id = IdPerspective::Instance().GetIdFromName("ProcessDepotentiation");
+	return id;
+}
+
+static Id PostDepotentiationId()
+{
+	static Id id = IdPerspective::Instance().GetIdFromName("PostDepotentiation");
+	return id;
+}
+
+static Id ReReadyId()
+{
+	static Id id = IdPerspective::Instance().GetIdFromName("ReReady");
+	return id;
+}
+
+void Dendrite::CommonConstructor()
+{
+	mcPrepareForPotentiation = NULL;
+	mcProcessPotentiation = NULL;
+	mcPostPotentiation = NULL;
+	mcPrepareForDepotentiation = NULL;
+	mcProcessDepotentiation = NULL;
+	mcPostDepotentiation = NULL;
+	mcReReady = NULL;
+}
+
+Dendrite::~Dendrite()
+{
+	if (mSheath.mGlia)
+	{
+		mSheath.mGlia->Forget(this);
+	}
 }
 
 Code Dendrite::CacheProteins()
 {
-	mcPrepareForPotentiation = GetByName< molecular::Protein* >("PrepareForPotentiation");
-	mcProcessPotentiation = GetByName< molecular::Protein* >("ProcessPotentiation");
-	mcPostPotentiation = GetByName< molecular::Protein* >("PostPotentiation");
+	//Slots are filled by Id on their next use.
+	mcPrepareForPotentiation = NULL;
+	mcProcessPotentiation = NULL;
+	mcPostPotentiation = NULL;
 
-	mcPrepareForDepotentiation = GetByName< molecular::Protein* >("PrepareForDepotentiation");
-	mcProcessDepotentiation = GetByName< molecular::Protein* >("ProcessDepotentiation");
-	mcPostDepotentiation = GetByName< molecular::Protein* >("PostDepotentiation");
+	mcPrepareForDepotentiation = NULL;
+	mcProcessDepotentiation = NULL;
+	mcPostDepotentiation = NULL;
 
-	mcReReady = GetByName< molecular::Protein* >("ReReady");
+	mcReReady = NULL;
 
 	return Neurite::CacheProteins();
 }
 
 Code Dendrite::CreateDefaultProteins()
 {
-	Add< molecular::Protein* >(new molecular::Protein("PrepareForPotentiation"));
-	Add< molecular::Protein* >(new molecular::Protein("ProcessPotentiation"));
-	Add< molecular::Protein* >(new molecular::Protein("PostPotentiation"));
+	ExpressProtein(mcPrepareForPotentiation, PrepareForPotentiationId(), false); //Bound during use, so not shared.
+	ExpressProtein(mcProcessPotentiation, ProcessPotentiationId());
+	ExpressProtein(mcPostPotentiation, PostPotentiationId());
 
-	Add< molecular::Protein* >(new molecular::Protein("PrepareForDepotentiation"));
-	Add< molecular::Protein* >(new molecular::Protein("ProcessDepotentiation"));
-	Add< molecular::Protein* >(new molecular::Protein("PostDepotentiation"));
+	ExpressProtein(mcPrepareForDepotentiation, PrepareForDepotentiationId());
+	ExpressProtein(mcProcessDepotentiation, ProcessDepotentiationId());
+	ExpressProtein(mcPostDepotentiation, PostDepotentiationId());
 
-	Add< molecular::Protein* >(new molecular::Protein("ReReady"));
+	ExpressProtein(mcReReady, ReReadyId());
 
 	return Neurite::CreateDefaultProteins();
 }
@@ -124,7 +187,7 @@ void Dendrite::Potentiated()
 	}
 	Add< State >(state::Potentiated());
 	mLastPotentiated = physical::GetCurrentTimestamp();
-	NoLongerReady();
+	NoLongerReady(); //will UpdateGlia().
 }
 
 void Dendrite::Depotentiated()
@@ -141,26 +204,29 @@ void Dendrite::Depotentiated()
 			GetName().AsCharString());
 	}
 	Remove< State >(state::Potentiated());
+	UpdateGlia();
 }
 
 Timestamp Dendrite::PrepareForPotentiation(Timestamp whenToPotentiate)
 {
 	static Id bindingSite = IdPerspective::Instance().GetIdFromName("WhenToPotentiate");
+	ExpressProtein(mcPrepareForPotentiation, PrepareForPotentiationId(), false);
 	mcPrepareForPotentiation->RotateTo(bindingSite)->Bind(whenToPotentiate);
 	(*mcPrepareForPotentiation)();
-	Timestamp ret = mcPrepareForPotentiation->RotateTo(bindingSite)->Probe< Timestamp >();
+	const molecular::Surface* potentiateAt = mcPrepareForPotentiation->RotateTo(bindingSite);
+	Timestamp ret = potentiateAt->Probe< Timestamp >();
 	mcPrepareForPotentiation->RotateTo(bindingSite)->Release();
 	return ret;
 }
 
 void Dendrite::PrepareForDepotentiation()
 {
-	(*mcPrepareForDepotentiation)();
+	(*ExpressProtein(mcPrepareForDepotentiation, PrepareForDepotentiationId()))();
 }
 
 void Dendrite::ReReady()
 {
-	(*mcReReady)();
+	(*ExpressProtein(mcReReady, ReReadyId()))();
 }
 
 Timestamp Dendrite::GetTimeToAdd() const
@@ -168,30 +234,44 @@ Timestamp Dendrite::GetTimeToAdd() const
 	return mPotentiateAt;
 }
 
+Timestamp Dendrite::GetTimeToDepotentiate() const
+{
+	return ::std::numeric_limits< Timestamp >::max();
+}
+
+void Dendrite::UpdateGlia()
+{
+	if (mSheath.mGlia)
+	{
+		mSheath.mGlia->RequestMirror(this);
+	}
+}
+
 Code Dendrite::ProcessPotentiation()
 {
-	return (*mcProcessPotentiation)();
+	return (*ExpressProtein(mcProcessPotentiation, ProcessPotentiationId()))();
 }
 
 Code Dendrite::ProcessDepotentiation()
 {
-	return (*mcProcessDepotentiation)();
+	return (*ExpressProtein(mcProcessDepotentiation, ProcessDepotentiationId()))();
 }
 
 Code Dendrite::PostPotentiation()
 {
-	return (*mcPostPotentiation)();
+	return (*ExpressProtein(mcPostPotentiation, PostPotentiationId()))();
 }
 
 Code Dendrite::PostDepotentiation()
 {
-	return (*mcPostDepotentiation)();
+	return (*ExpressProtein(mcPostDepotentiation, PostDepotentiationId()))();
 }
 
 void Dendrite::NoLongerReady()
 {
 	Remove< State >(state::Ready());
 	mPotentiateAt = 0; //FIXME: this could be incrementing the timestamp.
+	UpdateGlia();
 }
 
 Neuron* Dendrite::GetPostsynapticNeuron()
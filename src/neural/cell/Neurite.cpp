@@ -24,6 +24,28 @@
 namespace bio {
 namespace neural {
 
+/**
+ * Protein slots; see genetic::Expressor::ExpressProtein(). <br />
+ * Ids are looked up on first use rather than during static initialization, when the IdPerspective may not exist yet. <br />
+ */
+static Id IsZeroId()
+{
+	static Id id = IdPerspective::Instance().GetIdFromName("IsZero");
+	return id;
+}
+
+static Id MakeZeroId()
+{
+	static Id id = IdPerspective::Instance().GetIdFromName("MakeZero");
+	return id;
+}
+
+void Neurite::CommonConstructor()
+{
+	mcIsZero = NULL;
+	mcMakeZero = NULL;
+}
+
 Neurite::~Neurite()
 {
 
@@ -31,28 +53,30 @@ Neurite::~Neurite()
 
 Code Neurite::CacheProteins()
 {
-	mcIsZero = GetByName< molecular::Protein* >("IsZero");
-	mcMakeZero = GetByName< molecular::Protein* >("MakeZero");
+	//Slots are filled by Id on their next use.
+	mcIsZero = NULL;
+	mcMakeZero = NULL;
 
 	return StemCell::CacheProteins();
 }
 
 Code Neurite::CreateDefaultProteins()
 {
-	Add< molecular::Protein* >(new molecular::Protein("IsZero"));
-	Add< molecular::Protein* >(new molecular::Protein("MakeZero"));
+	ExpressProtein(mcIsZero, IsZeroId());
+	ExpressProtein(mcMakeZero, MakeZeroId());
 
 	return StemCell::CreateDefaultProteins();
 }
 
 bool Neurite::IsZero() const
 {
-	return (*mcIsZero)();
+	Neurite* self = const_cast< Neurite* >(this); //Filling a slot does not change our value.
+	return (*self->ExpressProtein(self->mcIsZero, IsZeroId()))();
 }
 
 void Neurite::MakeZero()
 {
-	(*mcMakeZero)();
+	(*ExpressProtein(mcMakeZero, MakeZeroId()))();
 }
 
 } //neural namespace
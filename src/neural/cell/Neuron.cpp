@@ -25,8 +25,41 @@
 namespace bio {
 namespace neural {
 
+/**
+ * Protein slots; see genetic::Expressor::ExpressProtein(). <br />
+ * Ids are looked up on first use rather than during static initialization, when the IdPerspective may not exist yet. <br />
+ */
+static Id PreCrestId()
+{
+	static Id id = IdPerspective::Instance().GetIdFromName("PreCrest");
+	return id;
+}
+
+static Id PreSendId()
+{
+	static Id id = IdPerspective::Instance().GetIdFromName("PreSend");
+	return id;
+}
+
+static Id PostSendId()
+{
+	static Id id = IdPerspective::Instance().GetIdFromName("PostSend");
+	return id;
+}
+
+static Id LearnId()
+{
+	static Id id = IdPerspective::Instance().GetIdFromName("Learn");
+	return id;
+}
+
 void Neuron::CommonConstructor()
 {
+	mcPreCrest = NULL;
+	mcPreSend = NULL;
+	mcPostSend = NULL;
+	mcLearn = NULL;
+
 	CreateImpulse(
 		firing_condition::RisingEdge(),
 		"RisingEdge"
@@ -44,6 +77,10 @@ void Neuron::CommonConstructor()
 
 Neuron::~Neuron()
 {
+	if (mSheath.mGlia)
+	{
+		mSheath.mGlia->Forget(this);
+	}
 	BIO_LOG_DEBUG(
 		"Destroying %s",
 		GetName().AsCharString());
@@ -52,20 +89,21 @@ Neuron::~Neuron()
 
 Code Neuron::CreateDefaultProteins()
 {
-	Add< molecular::Protein* >(new molecular::Protein("PreCrest"));
-	Add< molecular::Protein* >(new molecular::Protein("PreSend"));
-	Add< molecular::Protein* >(new molecular::Protein("PostSend"));
-	Add< molecular::Protein* >(new molecular::Protein("Learn"));
+	ExpressProtein(mcPreCrest, PreCrestId());
+	ExpressProtein(mcPreSend, PreSendId());
+	ExpressProtein(mcPostSend, PostSendId());
+	ExpressProtein(mcLearn, LearnId());
 
 	return StemCell::CreateDefaultProteins();
 }
 
 Code Neuron::CacheProteins()
 {
-	mcPreCrest = GetByName< molecular::Protein* >("PreCrest");
-	mcPreSend = GetByName< molecular::Protein* >("PreSend");
-	mcPostSend = GetByName< molecular::Protein* >("PostSend");
-	mcLearn = GetByName< molecular::Protein* >("Learn");
+	//Slots are filled by Id on their next use.
+	mcPreCrest = NULL;
+	mcPreSend = NULL;
+	mcPostSend = NULL;
+	mcLearn = NULL;
 
 	UpdateImpulseCallers();
 
@@ -84,7 +122,7 @@ Code Neuron::Crest()
 
 void Neuron::PreCrest()
 {
-	(*mcPreCrest)();
+	(*ExpressProtein(mcPreCrest, PreCrestId()))();
 }
 
 bool Neuron::CheckIn()
@@ -96,12 +134,21 @@ bool Neuron::CheckIn()
 		return false;
 	}
 	mLastCrestTimestamp = now;
+	UpdateGlia();
 
 	PreCrest();
 	ProcessDendrites();
 	return StemCell::CheckIn();
 }
 
+void Neuron::UpdateGlia()
+{
+	if (mSheath.mGlia)
+	{
+		mSheath.mGlia->RequestMirror(this);
+	}
+}
+
 void Neuron::UpdateImpulseCallers()
 {
 	for (
@@ -137,7 +184,9 @@ bool Neuron::DetermineAndCallImpulseTriggers()
 {
 	bool ret = false;
 
-	if (!DetermineImpulseTriggers(ExciteTrigger()))
+	bool triggered = DetermineImpulseTriggers(ExciteTrigger());
+	UpdateGlia();
+	if (!triggered)
 	{
 		return ret;
 	}
@@ -178,11 +227,13 @@ bool Neuron::IsPersisting(const Timestamp now) const
 void Neuron::PersistFor(const Milliseconds ms)
 {
 	mPersistFor = ms;
+	UpdateGlia();
 }
 
 void Neuron::PersistUntil(const Timestamp time)
 {
 	mPersistFor = time - physical::GetCurrentTimestamp();
+	UpdateGlia();
 }
 
 void Neuron::ActiveNow()
@@ -191,12 +242,14 @@ void Neuron::ActiveNow()
 	if (now > mLastActive)
 	{
 		mLastActive = now;
+		UpdateGlia();
 	}
 }
 
 void Neuron::ActiveUntil(Timestamp time)
 {
 	mLastActive = time;
+	UpdateGlia();
 }
 
 Timestamp Neuron::GetTimeLastActive() const
@@ -215,7 +268,7 @@ bool Neuron::IsActive() const
 
 void Neuron::Learn()
 {
-	(*mcLearn)();
+	(*ExpressProtein(mcLearn, LearnId()))();
 }
 
 Synapse* Neuron::ConnectTo(
@@ -242,6 +295,19 @@ Synapse* Neuron::ConnectTo(
 			return *syn;
 		}
 	}
+	return GrowAxonTo(
+		target,
+		synapseType
+	);
+}
+
+Synapse* Neuron::GrowAxonTo(
+	Neuron* target,
+	const Synapse* synapseType
+)
+{
+	BIO_SANITIZE(target && synapseType, , return NULL)
+
 	Synapse* out = synapseType->ConfigureFor(
 		this,
 		target
@@ -250,6 +316,15 @@ Synapse* Neuron::ConnectTo(
 
 	Add< Axon* >(out);
 
+	if (mSheath.mGlia)
+	{
+		mSheath.mGlia->Ensheathe(this, static_cast< Axon* >(out));
+	}
+	if (target->mSheath.mGlia)
+	{
+		target->mSheath.mGlia->Ensheathe(target, static_cast< Dendrite* >(out));
+	}
+
 	BIO_LOG_DEBUG(
 		"%s created new synapse (%s) to %s",
 		GetName().AsCharString(),
@@ -276,6 +351,7 @@ void Neuron::RequestProcessingOf(Dendrite* source)
 			source->GetName().AsCharString());
 		PotentiateDendrite(source);
 	}
+	source->UpdateGlia();
 }
 
 void Neuron::PotentiateDendrite(Dendrite* dendrite)
@@ -369,7 +445,7 @@ void Neuron::DepotentiateDendrite(Dendrite* dendrite)
 
 void Neuron::PreSend()
 {
-	(*mcPreSend)();
+	(*ExpressProtein(mcPreSend, PreSendId()))();
 }
 
 Code Neuron::Transmit(Affinity* selection)
@@ -378,30 +454,85 @@ Code Neuron::Transmit(Affinity* selection)
 
 	Code ret = code::Success();
 
-	Axons axons;
-	if (selection)
+	if (!selection && mSheath.mGlia)
 	{
-		axons = GetAllLike< Axon* >(selection);
+		::std::vector< Axon* > axons;
+		mSheath.mGlia->GetAxons(this, axons);
+		for (
+			::std::size_t axn = 0;
+			axn < axons.size();
+			++axn
+			)
+		{
+			if (axons[axn] && TransmitThrough(axons[axn]) != code::Success())
+			{
+				ret = code::UnknownError(); //only unknown because we're lazy & don't want to elaborate.
+			}
+		}
 	}
-	else
+	else if (mSheath.mGlia)
 	{
-		axons = GetAll< Axon* >();
+		//Select from the span of Axons directly, rather than copying them into a new Container.
+		::std::vector< Axon* > axons;
+		mSheath.mGlia->GetAxons(this, axons);
+		::std::vector< Axon* > candidates;
+		::std::vector< const physical::Wave* > waves;
+		candidates.reserve(axons.size());
+		waves.reserve(axons.size());
+		for (
+			::std::size_t axn = 0;
+			axn < axons.size();
+			++axn
+			)
+		{
+			if (axons[axn])
+			{
+				candidates.push_back(axons[axn]);
+				waves.push_back(axons[axn]->AsWave());
+			}
+		}
+		::std::vector< ::std::size_t > selected;
+		if (!waves.empty())
+		{
+			selection->Select(
+				&waves[0],
+				waves.size(),
+				selected
+			);
+		}
+		for (
+			::std::size_t sel = 0;
+			sel < selected.size();
+			++sel
+			)
+		{
+			if (TransmitThrough(candidates[selected[sel]]) != code::Success())
+			{
+				ret = code::UnknownError(); //only unknown because we're lazy & don't want to elaborate.
+			}
+		}
 	}
-
-	for (
-		SmartIterator axn = axons.Begin();
-		!axn.IsAfterEnd();
-		++axn
-	) {
-		Code returned = axn.As< Axon* >()->ProcessOutgoing();
-		if (returned != code::Success() && returned != code::NoErrorNoSuccess())
+	else
+	{
+		Axons axons;
+		if (selection)
 		{
-			BIO_LOG_WARN(
-				"%s: did not successfully send %s",
-				GetName().AsCharString(),
-				axn.As< Axon* >()->GetName().AsCharString());
+			axons = GetAllLike< Axon* >(selection);
+		}
+		else
+		{
+			axons = GetAll< Axon* >();
+		}
 
-			ret = code::UnknownError(); //only unknown because we're lazy & don't want to elaborate.
+		for (
+			SmartIterator axn = axons.Begin();
+			!axn.IsAfterEnd();
+			++axn
+		) {
+			if (TransmitThrough(axn.As< Axon* >()) != code::Success())
+			{
+				ret = code::UnknownError(); //only unknown because we're lazy & don't want to elaborate.
+			}
 		}
 	}
 
@@ -410,9 +541,23 @@ Code Neuron::Transmit(Affinity* selection)
 	return ret;
 }
 
+Code Neuron::TransmitThrough(Axon* axon)
+{
+	Code returned = axon->ProcessOutgoing();
+	if (returned != code::Success() && returned != code::NoErrorNoSuccess())
+	{
+		BIO_LOG_WARN(
+			"%s: did not successfully send %s",
+			GetName().AsCharString(),
+			axon->GetName().AsCharString());
+		return code::UnknownError();
+	}
+	return code::Success();
+}
+
 void Neuron::PostSend()
 {
-	(*mcPostSend)();
+	(*ExpressProtein(mcPostSend, PostSendId()))();
 }
 
 Code Neuron::DepotentiateSentData(Affinity* selection)
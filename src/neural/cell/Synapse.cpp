@@ -25,13 +25,29 @@
 namespace bio {
 namespace neural {
 
+/**
+ * Protein slots; see genetic::Expressor::ExpressProtein(). <br />
+ * Ids are looked up on first use rather than during static initialization, when the IdPerspective may not exist yet. <br />
+ */
+static Id AdditionalConfigurationId()
+{
+	static Id id = IdPerspective::Instance().GetIdFromName("AdditionalConfiguration");
+	return id;
+}
+
+void Synapse::CommonConstructor()
+{
+	mcAdditionalConfiguration = NULL;
+}
+
 Synapse::~Synapse()
 {
 }
 
 Code Synapse::CacheProteins()
 {
-	mcAdditionalConfiguration = GetByName< molecular::Protein* >("AdditionalConfiguration");
+	//Slots are filled by Id on their next use.
+	mcAdditionalConfiguration = NULL;
 	
 	Axon::CacheProteins();
 	Dendrite::CacheProteins();
@@ -41,7 +57,7 @@ Code Synapse::CacheProteins()
 
 Code Synapse::CreateDefaultProteins()
 {
-	Add< molecular::Protein* >(new molecular::Protein("AdditionalConfiguration"));
+	ExpressProtein(mcAdditionalConfiguration, AdditionalConfigurationId(), false); //Bound during use, so not shared.
 	
 	Axon::CreateDefaultProteins();
 	Dendrite::CreateDefaultProteins();
@@ -75,6 +91,7 @@ void Synapse::AdditionalConfiguration(
 	BIO_SANITIZE(presynapticNeuron && postsynapticNeuron, , return)
 	static Id presynapticBindingSite = IdPerspective::Instance().GetIdFromName("PresynapticNeuron");
 	static Id postsynapticBindingSite = IdPerspective::Instance().GetIdFromName("PostsynapticNeuron");
+	ExpressProtein(mcAdditionalConfiguration, AdditionalConfigurationId(), false);
 	mcAdditionalConfiguration->RotateTo(presynapticBindingSite)->Bind(*presynapticNeuron);
 	mcAdditionalConfiguration->RotateTo(postsynapticBindingSite)->Bind(*postsynapticNeuron);
 	(*mcAdditionalConfiguration)();
@@ -87,12 +104,17 @@ void Synapse::Update(Timestamp whenToPotentiate)
 	Axon::Update(whenToPotentiate);
 	Add< State >(state::Ready());
 	mPotentiateAt = whenToPotentiate;
+	UpdateGlia();
 
 	//NOTE: Depotentiation time may be extended later or other data edits may occur
 	//This is better than GetTimeToAdd == GetCurrentTimestamp.
 	//FIXME: bug when GetCurrentTimestamp = UINT_MAX
 	if (GetTimeToAdd() <= GetTimeLastUpdated())
 	{
+		if (Dendrite::mSheath.mGlia && Dendrite::mSheath.mGlia->IsEventDriven())
+		{
+			return; //UpdateGlia() queued us; the postsynaptic Neuron will be processed on the next Tick.
+		}
 		GetPostsynapticNeuron()->RequestProcessingOf(this);
 	}
 }
@@ -139,5 +161,20 @@ void Synapse::ExtendTimeoutUntil(Timestamp timeToDepotentiate)
 	SetTimeout(timeToDepotentiate - mPotentiateAt);
 }
 
+void Synapse::SetTimeout(Milliseconds lastFor)
+{
+	Axon::SetTimeout(lastFor);
+	UpdateGlia();
+}
+
+Timestamp Synapse::GetTimeToDepotentiate() const
+{
+	if (Has< Feature >(feature::Timeout()))
+	{
+		return mLastPotentiated + mTimeout;
+	}
+	return Dendrite::GetTimeToDepotentiate();
+}
+
 } //namespace neural
 } //namespace bio
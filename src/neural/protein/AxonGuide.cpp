@@ -21,6 +21,11 @@
 
 #include "bio/neural/protein/AxonGuide.h"
 #include "bio/neural/tissue/Neuropil.h"
+#include "bio/neural/cell/Neuron.h"
+#include "bio/neural/cell/Synapse.h"
+
+#include <algorithm>
+#include <limits>
 
 namespace bio {
 namespace neural {
@@ -45,11 +50,188 @@ Code AxonGuide::Fold()
 	static Id presynapticNeuropilBindingSite = IdPerspective::Instance().GetIdFromName("PresynapticNeuropil");
 	static Id postsynapticNeuropilBindingSite = IdPerspective::Instance().GetIdFromName("PostsynapticNeuropil");
 
+	static Id synapseBindingSite = IdPerspective::Instance().GetIdFromName("Synapse");
+	static Id presynapticNeuronAffinityBindingSite = IdPerspective::Instance().GetIdFromName("PresynapticNeuronAffinity");
+	static Id postsynapticNeuronAffinityBindingSite = IdPerspective::Instance().GetIdFromName("PostsynapticNeuronAffinity");
+
 	mPresynapticNeuropil = &(RotateTo(presynapticNeuropilBindingSite)->Probe< Neuropil >());
 	mPostsynapticNeuropil = &(RotateTo(postsynapticNeuropilBindingSite)->Probe< Neuropil >());
+	mSynapse = &(RotateTo(synapseBindingSite)->Probe< Synapse >());
+
+	//The Affinities are optional, so we can't Probe them.
+	const Affinity* presynapticNeuronAffinity = NULL;
+	const Affinity* postsynapticNeuronAffinity = NULL;
+	molecular::Surface* surface = RotateTo(presynapticNeuronAffinityBindingSite);
+	if (surface)
+	{
+		presynapticNeuronAffinity = surface->As< Affinity* >();
+	}
+	surface = RotateTo(postsynapticNeuronAffinityBindingSite);
+	if (surface)
+	{
+		postsynapticNeuronAffinity = surface->As< Affinity* >();
+	}
+
+	Gather(
+		mPresynapticNeuropil,
+		presynapticNeuronAffinity,
+		mPresynapticNeurons
+	);
+	Gather(
+		mPostsynapticNeuropil,
+		postsynapticNeuronAffinity,
+		mPostsynapticNeurons
+	);
 
 	return Protein::Fold();
 }
 
+/*static*/ void AxonGuide::Gather(
+	Neuropil* neuropil,
+	const Affinity* affinity,
+	::std::vector< Neuron* >& candidates
+)
+{
+	candidates.clear();
+	BIO_SANITIZE(neuropil, , return)
+	Container* cells = neuropil->GetAll< cellular::Cell* >();
+	BIO_SANITIZE(cells, , return)
+	candidates.reserve(cells->GetNumberOfElements());
+
+	Neuron* neuron;
+	for (
+		SmartIterator cel = cells->Begin();
+		!cel.IsAfterEnd();
+		++cel
+		)
+	{
+		neuron = ChemicalCast< Neuron* >(cel.As< cellular::Cell* >());
+		if (neuron)
+		{
+			candidates.push_back(neuron);
+		}
+	}
+	if (!affinity || candidates.empty())
+	{
+		return;
+	}
+
+	//Score every candidate at once & keep only those with Attraction.
+	::std::vector< const physical::Wave* > waves(candidates.size());
+	for (
+		::std::size_t can = 0;
+		can < candidates.size();
+		++can
+		)
+	{
+		waves[can] = candidates[can]->AsWave();
+	}
+	::std::vector< ::std::size_t > selected;
+	affinity->Select(
+		&waves[0],
+		waves.size(),
+		selected
+	);
+	for (
+		::std::size_t sel = 0;
+		sel < selected.size();
+		++sel
+		)
+	{
+		candidates[sel] = candidates[selected[sel]];
+	}
+	candidates.resize(selected.size());
+}
+
+Code AxonGuide::Wire(Projections& projections)
+{
+	static Id synapsesBindingSite = IdPerspective::Instance().GetIdFromName("Synapses");
+
+	mSynapses.Clear();
+	BIO_SANITIZE(mSynapse, , return code::MissingArgument1())
+
+	::std::sort(
+		projections.begin(),
+		projections.end());
+	projections.erase(
+		::std::unique(
+			projections.begin(),
+			projections.end()),
+		projections.end());
+
+	Code ret = code::Success();
+	const Id synapseId = mSynapse->GetId();
+
+	//The postsynaptic Neurons the current presynaptic Neuron already has Synapses of our type to, sorted for binary search.
+	::std::vector< const Neuron* > existing;
+	::std::size_t presynaptic = ::std::numeric_limits< ::std::size_t >::max();
+
+	Neuron* presynapticNeuron = NULL;
+	Neuron* postsynapticNeuron;
+	Synapse* synapse;
+	for (
+		Projections::const_iterator prj = projections.begin();
+		prj != projections.end();
+		++prj
+		)
+	{
+		BIO_SANITIZE(prj->first < mPresynapticNeurons.size() && prj->second < mPostsynapticNeurons.size(), , continue)
+
+		if (prj->first != presynaptic)
+		{
+			presynaptic = prj->first;
+			presynapticNeuron = mPresynapticNeurons[presynaptic];
+			existing.clear();
+			Container* axons = presynapticNeuron->GetAll< Axon* >();
+			if (axons)
+			{
+				for (
+					SmartIterator axn = axons->Begin();
+					!axn.IsAfterEnd();
+					++axn
+					)
+				{
+					synapse = ChemicalCast< Synapse* >(axn.As< Axon* >());
+					if (synapse && synapse->IsId(synapseId))
+					{
+						existing.push_back(synapse->GetPostsynapticNeuron());
+					}
+				}
+				::std::sort(
+					existing.begin(),
+					existing.end());
+			}
+		}
+
+		postsynapticNeuron = mPostsynapticNeurons[prj->second];
+		if (::std::binary_search(
+			existing.begin(),
+			existing.end(),
+			postsynapticNeuron))
+		{
+			continue;
+		}
+
+		synapse = presynapticNeuron->GrowAxonTo(
+			postsynapticNeuron,
+			mSynapse
+		);
+		if (!synapse)
+		{
+			ret = code::UnknownError();
+			continue;
+		}
+		mSynapses.Add(synapse);
+	}
+
+	molecular::Surface* surface = RotateTo(synapsesBindingSite);
+	if (surface)
+	{
+		surface->Use(&mSynapses);
+	}
+
+	return ret;
+}
+
 } // namespace neural
 } // namespace bio
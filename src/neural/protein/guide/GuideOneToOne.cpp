@@ -31,7 +31,22 @@ GuideOneToOne::~GuideOneToOne()
 
 Code GuideOneToOne::Activate()
 {
-	return AxonGuide::Activate();
+	const ::std::size_t count = mPresynapticNeurons.size() < mPostsynapticNeurons.size() ? mPresynapticNeurons.size() : mPostsynapticNeurons.size();
+
+	Projections projections;
+	projections.reserve(count);
+	for (
+		::std::size_t prj = 0;
+		prj < count;
+		++prj
+		)
+	{
+		projections.push_back(Projection(prj, prj));
+	}
+
+	Code ret = Wire(projections);
+	Code activated = AxonGuide::Activate();
+	return ret == code::Success() ? activated : ret;
 }
 
 } // namespace neural
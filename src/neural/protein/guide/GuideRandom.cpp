@@ -20,10 +20,90 @@
  */
 
 #include "bio/neural/protein/guide/GuideRandom.h"
+#include "bio/common/Random.h"
+
+#include <cmath>
+#if BIO_CPP_VERSION >= 11
+	#include <thread>
+	#include <functional>
+#endif
 
 namespace bio {
 namespace neural {
 
+/**
+ * The fewest presynaptic Neurons worth starting a thread for. <br />
+ */
+static const ::std::size_t sRowsPerThread = 256;
+
+/**
+ * Generate the Projections for the presynaptic candidates in [begin, end). <br />
+ * Each row has its own random::Stream, so the result does not depend on how the rows are divided. <br />
+ */
+static void Project(
+	::std::size_t begin,
+	::std::size_t end,
+	::std::size_t columns,
+	float probability,
+	uint64_t seed,
+	AxonGuide::Projections& projections
+)
+{
+	if (probability <= 0.0f || !columns)
+	{
+		return;
+	}
+	const double logOfMiss = probability < 1.0f ? ::std::log(1.0 - probability) : 0.0;
+	random::Stream stream(seed, 0);
+	double skip;
+	::std::size_t col;
+	for (
+		::std::size_t row = begin;
+		row < end;
+		++row
+		)
+	{
+		if (probability >= 1.0f)
+		{
+			for (
+				col = 0;
+				col < columns;
+				++col
+				)
+			{
+				projections.push_back(AxonGuide::Projection(row, col));
+			}
+			continue;
+		}
+
+		stream.Reset(
+			seed,
+			static_cast< uint64_t >(row)
+		);
+		stream.Skip(1);
+		for (
+			col = 0;
+			;
+			++col
+			)
+		{
+			skip = ::std::floor(::std::log(stream.Uniform()) / logOfMiss);
+			if (skip >= static_cast< double >(columns - col))
+			{
+				break;
+			}
+			col += static_cast< ::std::size_t >(skip);
+			projections.push_back(AxonGuide::Projection(row, col));
+		}
+	}
+}
+
+void GuideRandom::CommonConstructor()
+{
+	mConnectionProbability = 0.1f;
+	mSeed = 0;
+}
+
 GuideRandom::~GuideRandom()
 {
 	
@@ -31,7 +111,98 @@ GuideRandom::~GuideRandom()
 
 Code GuideRandom::Activate()
 {
-	return AxonGuide::Activate();
+	const ::std::size_t rows = mPresynapticNeurons.size();
+	const ::std::size_t columns = mPostsynapticNeurons.size();
+
+	Projections projections;
+
+	#if BIO_CPP_VERSION >= 11
+	::std::size_t threads = ::std::thread::hardware_concurrency();
+	if (threads > rows / sRowsPerThread)
+	{
+		threads = rows / sRowsPerThread;
+	}
+	if (threads > 1)
+	{
+		::std::vector< Projections > parts(threads);
+		::std::vector< ::std::thread > workers;
+		workers.reserve(threads);
+		const ::std::size_t stride = (rows + threads - 1) / threads;
+		for (
+			::std::size_t thr = 0;
+			thr < threads;
+			++thr
+			)
+		{
+			workers.push_back(::std::thread(
+				Project,
+				thr * stride,
+				(thr + 1) * stride < rows ? (thr + 1) * stride : rows,
+				columns,
+				mConnectionProbability,
+				mSeed,
+				::std::ref(parts[thr])
+			));
+		}
+		::std::size_t total = 0;
+		for (
+			::std::size_t thr = 0;
+			thr < threads;
+			++thr
+			)
+		{
+			workers[thr].join();
+			total += parts[thr].size();
+		}
+		projections.reserve(total);
+		for (
+			::std::size_t thr = 0;
+			thr < threads;
+			++thr
+			)
+		{
+			projections.insert(
+				projections.end(),
+				parts[thr].begin(),
+				parts[thr].end());
+		}
+	}
+	else
+	#endif
+	{
+		Project(
+			0,
+			rows,
+			columns,
+			mConnectionProbability,
+			mSeed,
+			projections
+		);
+	}
+
+	Code ret = Wire(projections);
+	Code activated = AxonGuide::Activate();
+	return ret == code::Success() ? activated : ret;
+}
+
+void GuideRandom::SetConnectionProbability(float probability)
+{
+	mConnectionProbability = probability;
+}
+
+float GuideRandom::GetConnectionProbability() const
+{
+	return mConnectionProbability;
+}
+
+void GuideRandom::SetSeed(uint64_t seed)
+{
+	mSeed = seed;
+}
+
+uint64_t GuideRandom::GetSeed() const
+{
+	return mSeed;
 }
 
 } // namespace neural
@@ -0,0 +1,1080 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2023 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "bio/neural/tissue/Glia.h"
+#include "bio/neural/cell/Neuron.h"
+#include "bio/neural/cell/Dendrite.h"
+#include "bio/neural/cell/Axon.h"
+#include "bio/neural/common/FiringConditions.h"
+
+#include <limits>
+#include <algorithm>
+
+namespace bio {
+namespace neural {
+
+const Timestamp Glia::sNever = ::std::numeric_limits< Timestamp >::max();
+const ::std::size_t Glia::sNowhere = ::std::numeric_limits< ::std::size_t >::max();
+
+/**
+ * Orders newly Ensheathed Dendrites & Axons by their Neuron. <br />
+ */
+template < typename T >
+static bool ByNeuron(
+	const ::std::pair< ::std::size_t, T >& lhs,
+	const ::std::pair< ::std::size_t, T >& rhs
+)
+{
+	return lhs.first < rhs.first;
+}
+
+/**
+ * Move the contents of toRearrange such that toRearrange[i] becomes toRearrange[order[i]]. <br />
+ * Where order[i] is Glia::sNowhere, fill is used instead. <br />
+ */
+template < typename T >
+static void Rearrange(
+	::std::vector< T >& toRearrange,
+	const ::std::vector< ::std::size_t >& order,
+	const T& fill,
+	const ::std::size_t nowhere
+)
+{
+	::std::vector< T > rearranged(
+		order.size(),
+		fill
+	);
+	for (
+		::std::size_t idx = 0;
+		idx < order.size();
+		++idx
+		)
+	{
+		if (order[idx] != nowhere)
+		{
+			rearranged[idx] = toRearrange[order[idx]];
+		}
+	}
+	toRearrange.swap(rearranged);
+}
+
+/**
+ * Build the order needed to merge the given additions into the given compressed sparse rows. <br />
+ * @param offsets the existing rows; will be updated to include the additions.
+ * @param additions must be sorted by row.
+ * @param order will be filled with the old index of each new entry or nowhere for additions.
+ * @param added will be filled with the addition for each new entry or NULL for existing entries.
+ */
+template < typename T >
+static void Merge(
+	::std::vector< ::std::size_t >& offsets,
+	const ::std::vector< ::std::pair< ::std::size_t, T > >& additions,
+	::std::vector< ::std::size_t >& order,
+	::std::vector< T >& added,
+	const ::std::size_t nowhere
+)
+{
+	const ::std::size_t rows = offsets.size() - 1;
+	::std::vector< ::std::size_t > merged(
+		offsets.size(),
+		0
+	);
+	::std::size_t add = 0;
+	for (
+		::std::size_t row = 0;
+		row < rows;
+		++row
+		)
+	{
+		merged[row] = order.size();
+		for (
+			::std::size_t old = offsets[row];
+			old < offsets[row + 1];
+			++old
+			)
+		{
+			order.push_back(old);
+			added.push_back(NULL);
+		}
+		for (
+			;
+			add < additions.size() && additions[add].first == row;
+			++add
+			)
+		{
+			order.push_back(nowhere);
+			added.push_back(additions[add].second);
+		}
+	}
+	merged[rows] = order.size();
+	offsets.swap(merged);
+}
+
+Glia::Glia()
+	:
+	mEventDriven(false)
+{
+	mDendriteOffsets.push_back(0);
+	mAxonOffsets.push_back(0);
+}
+
+Glia::~Glia()
+{
+	Clear();
+}
+
+bool Glia::Ensheathe(Neuron* neuron)
+{
+	BIO_SANITIZE(neuron, , return false)
+	if (neuron->mSheath.mGlia == this)
+	{
+		return false;
+	}
+	if (neuron->mSheath.mGlia)
+	{
+		neuron->mSheath.mGlia->Forget(neuron);
+	}
+
+	neuron->mSheath.mGlia = this;
+	neuron->mSheath.mIndex = mNeurons.size();
+	mNeurons.push_back(neuron);
+	mIntervals.push_back(0);
+	mLastCrests.push_back(0);
+	mLastActive.push_back(0);
+	mPersistFor.push_back(0);
+	mFiringReasons.push_back(firing_condition::None());
+	mPersisting.push_back(0);
+	mPersistenceLapsed.push_back(0);
+	mDue.push_back(0);
+	mNextEvents.push_back(sNever);
+	Mirror(neuron);
+
+	Dendrite* dendrite;
+	Container* dendrites = neuron->GetAll< Dendrite* >();
+	if (dendrites)
+	{
+		for (
+			SmartIterator den = dendrites->Begin();
+			!den.IsAfterEnd();
+			++den
+			)
+		{
+			dendrite = den.As< Dendrite* >();
+			BIO_SANITIZE(dendrite, , continue)
+			if (dendrite->mSheath.mGlia)
+			{
+				dendrite->mSheath.mGlia->Forget(dendrite);
+			}
+			dendrite->mSheath.mGlia = this;
+			dendrite->mSheath.mIndex = mDendrites.size();
+			mDendrites.push_back(dendrite);
+			mDendriteStates.push_back(0);
+			mPotentiateAt.push_back(0);
+			mDepotentiateAt.push_back(0);
+			mPending.push_back(0);
+			mDendriteOwners.push_back(neuron->mSheath.mIndex);
+			mDendriteDeadlines.push_back(sNever);
+			Mirror(dendrite);
+		}
+	}
+	mDendriteOffsets.push_back(mDendrites.size());
+
+	Axon* axon;
+	Container* axons = neuron->GetAll< Axon* >();
+	if (axons)
+	{
+		for (
+			SmartIterator axn = axons->Begin();
+			!axn.IsAfterEnd();
+			++axn
+			)
+		{
+			axon = axn.As< Axon* >();
+			BIO_SANITIZE(axon, , continue)
+			if (axon->mSheath.mGlia)
+			{
+				axon->mSheath.mGlia->Forget(axon);
+			}
+			axon->mSheath.mGlia = this;
+			axon->mSheath.mIndex = mAxons.size();
+			mAxons.push_back(axon);
+		}
+	}
+	mAxonOffsets.push_back(mAxons.size());
+	return true;
+}
+
+bool Glia::Ensheathe(
+	Neuron* neuron,
+	Dendrite* dendrite
+)
+{
+	BIO_SANITIZE(neuron && dendrite, , return false)
+	if (neuron->mSheath.mGlia != this || dendrite->mSheath.mGlia == this)
+	{
+		return false;
+	}
+	if (dendrite->mSheath.mGlia)
+	{
+		dendrite->mSheath.mGlia->Forget(dendrite);
+	}
+	dendrite->mSheath.mGlia = this;
+	dendrite->mSheath.mIndex = sNowhere;
+	LockThread();
+	mNewDendrites.push_back(::std::make_pair(neuron->mSheath.mIndex, dendrite));
+	UnlockThread();
+	return true;
+}
+
+bool Glia::Ensheathe(
+	Neuron* neuron,
+	Axon* axon
+)
+{
+	BIO_SANITIZE(neuron && axon, , return false)
+	if (neuron->mSheath.mGlia != this || axon->mSheath.mGlia == this)
+	{
+		return false;
+	}
+	if (axon->mSheath.mGlia)
+	{
+		axon->mSheath.mGlia->Forget(axon);
+	}
+	axon->mSheath.mGlia = this;
+	axon->mSheath.mIndex = sNowhere;
+	LockThread();
+	mNewAxons.push_back(::std::make_pair(neuron->mSheath.mIndex, axon));
+	UnlockThread();
+	return true;
+}
+
+void Glia::Grow()
+{
+	::std::vector< ::std::size_t > order;
+
+	//Mirror & Reschedule lock *this, so take the staged Dendrites out before merging them.
+	LockThread();
+	mGrowingDendrites.swap(mNewDendrites);
+	UnlockThread();
+
+	if (!mGrowingDendrites.empty())
+	{
+		::std::stable_sort(mGrowingDendrites.begin(), mGrowingDendrites.end(), ByNeuron< Dendrite* >);
+		::std::vector< Dendrite* > added;
+		Merge(mDendriteOffsets, mGrowingDendrites, order, added, sNowhere);
+		mGrowingDendrites.clear();
+
+		Rearrange(mDendrites, order, (Dendrite*)NULL, sNowhere);
+		Rearrange(mDendriteStates, order, (uint8_t)0, sNowhere);
+		Rearrange(mPotentiateAt, order, (Timestamp)0, sNowhere);
+		Rearrange(mDepotentiateAt, order, (Timestamp)0, sNowhere);
+		Rearrange(mPending, order, (uint8_t)0, sNowhere);
+		Rearrange(mDendriteDeadlines, order, sNever, sNowhere);
+
+		mDendriteOwners.resize(order.size());
+		for (
+			::std::size_t neu = 0;
+			neu < mNeurons.size();
+			++neu
+			)
+		{
+			for (
+				::std::size_t den = mDendriteOffsets[neu];
+				den < mDendriteOffsets[neu + 1];
+				++den
+				)
+			{
+				mDendriteOwners[den] = neu;
+				if (added[den])
+				{
+					mDendrites[den] = added[den];
+				}
+				if (mDendrites[den])
+				{
+					mDendrites[den]->mSheath.mIndex = den;
+				}
+				if (added[den])
+				{
+					Mirror(added[den]);
+				}
+			}
+		}
+		order.clear();
+
+		//Dendrite timers refer to the old indices.
+		Reschedule();
+	}
+
+	//GetAxons may be called from any thread, so the Axons are merged entirely under the lock.
+	LockThread();
+	if (!mNewAxons.empty())
+	{
+		::std::stable_sort(mNewAxons.begin(), mNewAxons.end(), ByNeuron< Axon* >);
+		::std::vector< Axon* > added;
+		Merge(mAxonOffsets, mNewAxons, order, added, sNowhere);
+		mNewAxons.clear();
+
+		Rearrange(mAxons, order, (Axon*)NULL, sNowhere);
+		for (
+			::std::size_t axn = 0;
+			axn < mAxons.size();
+			++axn
+			)
+		{
+			if (added[axn])
+			{
+				mAxons[axn] = added[axn];
+			}
+			if (mAxons[axn])
+			{
+				mAxons[axn]->mSheath.mIndex = axn;
+			}
+		}
+	}
+	UnlockThread();
+}
+
+void Glia::Support(cellular::Cell* cell)
+{
+	BIO_SANITIZE(cell, , return)
+	mSupported.push_back(cell);
+}
+
+void Glia::Clear()
+{
+	for (
+		::std::size_t neu = 0;
+		neu < mNeurons.size();
+		++neu
+		)
+	{
+		if (mNeurons[neu])
+		{
+			mNeurons[neu]->mSheath.mGlia = NULL;
+		}
+	}
+	for (
+		::std::size_t den = 0;
+		den < mDendrites.size();
+		++den
+		)
+	{
+		if (mDendrites[den])
+		{
+			mDendrites[den]->mSheath.mGlia = NULL;
+		}
+	}
+	for (
+		::std::size_t axn = 0;
+		axn < mAxons.size();
+		++axn
+		)
+	{
+		if (mAxons[axn])
+		{
+			mAxons[axn]->mSheath.mGlia = NULL;
+		}
+	}
+	for (
+		::std::size_t den = 0;
+		den < mNewDendrites.size();
+		++den
+		)
+	{
+		mNewDendrites[den].second->mSheath.mGlia = NULL;
+	}
+	for (
+		::std::size_t axn = 0;
+		axn < mNewAxons.size();
+		++axn
+		)
+	{
+		mNewAxons[axn].second->mSheath.mGlia = NULL;
+	}
+
+	mNeurons.clear();
+	mIntervals.clear();
+	mLastCrests.clear();
+	mLastActive.clear();
+	mPersistFor.clear();
+	mFiringReasons.clear();
+	mPersisting.clear();
+	mPersistenceLapsed.clear();
+	mDue.clear();
+	mNextEvents.clear();
+	mDendriteOffsets.clear();
+	mDendriteOffsets.push_back(0);
+
+	mDendrites.clear();
+	mDendriteStates.clear();
+	mPotentiateAt.clear();
+	mDepotentiateAt.clear();
+	mPending.clear();
+	mDendriteOwners.clear();
+	mDendriteDeadlines.clear();
+
+	mSupported.clear();
+
+	LockThread();
+	mAxons.clear();
+	mAxonOffsets.clear();
+	mAxonOffsets.push_back(0);
+	mNewDendrites.clear();
+	mNewAxons.clear();
+	mWheel.Clear();
+	mNeuronsToMirror.clear();
+	mDendritesToMirror.clear();
+	UnlockThread();
+	mExpired.clear();
+	mArrivals.clear();
+	mFired.clear();
+}
+
+void Glia::Mirror(const Neuron* neuron)
+{
+	if (!neuron || neuron->mSheath.mGlia != this || neuron->mSheath.mIndex >= mNeurons.size() || mNeurons[neuron->mSheath.mIndex] != neuron)
+	{
+		return;
+	}
+	const ::std::size_t neu = neuron->mSheath.mIndex;
+
+	mIntervals[neu] = neuron->GetInterval();
+	mLastCrests[neu] = neuron->GetTimeLastCrested();
+	mLastActive[neu] = neuron->mLastActive;
+	mPersistFor[neu] = neuron->mPersistFor;
+	mFiringReasons[neu] = neuron->mFiringReason;
+	mPersisting[neu] = neuron->IsPersisting(physical::GetCurrentTimestamp());
+
+	if (mPersisting[neu])
+	{
+		Schedule(neu, mLastActive[neu] + mPersistFor[neu]);
+	}
+}
+
+void Glia::Mirror(const Dendrite* dendrite)
+{
+	if (!dendrite || dendrite->mSheath.mGlia != this || dendrite->mSheath.mIndex >= mDendrites.size() || mDendrites[dendrite->mSheath.mIndex] != dendrite)
+	{
+		return;
+	}
+	MirrorDendrite(
+		dendrite->mSheath.mIndex,
+		0
+	);
+}
+
+void Glia::MirrorDendrite(
+	::std::size_t den,
+	Timestamp from
+)
+{
+	const Dendrite* dendrite = mDendrites[den];
+
+	uint8_t states = 0;
+	if (dendrite->Has< State >(state::Ready()))
+	{
+		states |= sReady;
+	}
+	if (dendrite->Has< State >(state::Potentiated()))
+	{
+		states |= sPotentiated;
+	}
+	mDendriteStates[den] = states;
+	mPotentiateAt[den] = dendrite->GetTimeToAdd();
+	mDepotentiateAt[den] = dendrite->GetTimeToDepotentiate();
+
+	ScheduleDendrite(
+		den,
+		from
+	);
+}
+
+void Glia::RequestMirror(const Neuron* neuron)
+{
+	LockThread();
+	mNeuronsToMirror.push_back(neuron);
+	UnlockThread();
+}
+
+void Glia::RequestMirror(const Dendrite* dendrite)
+{
+	LockThread();
+	mDendritesToMirror.push_back(dendrite);
+	UnlockThread();
+}
+
+void Glia::ApplyMirrorRequests()
+{
+	LockThread();
+	mApplyingNeurons.swap(mNeuronsToMirror);
+	mApplyingDendrites.swap(mDendritesToMirror);
+	UnlockThread();
+
+	//Mirror locks *this to Schedule, so we can't hold the lock here.
+	for (
+		::std::size_t neu = 0;
+		neu < mApplyingNeurons.size();
+		++neu
+		)
+	{
+		Mirror(mApplyingNeurons[neu]);
+	}
+	for (
+		::std::size_t den = 0;
+		den < mApplyingDendrites.size();
+		++den
+		)
+	{
+		Mirror(mApplyingDendrites[den]);
+	}
+	mApplyingNeurons.clear();
+	mApplyingDendrites.clear();
+}
+
+void Glia::Forget(const Neuron* neuron)
+{
+	LockThread();
+	mNeuronsToMirror.erase(
+		::std::remove(
+			mNeuronsToMirror.begin(),
+			mNeuronsToMirror.end(),
+			neuron
+		),
+		mNeuronsToMirror.end());
+	UnlockThread();
+	if (!neuron || neuron->mSheath.mGlia != this || neuron->mSheath.mIndex >= mNeurons.size() || mNeurons[neuron->mSheath.mIndex] != neuron)
+	{
+		return;
+	}
+	const ::std::size_t neu = neuron->mSheath.mIndex;
+
+	mNeurons[neu] = NULL;
+	mIntervals[neu] = 0;
+	mLastCrests[neu] = sNever; //never due.
+	mNextEvents[neu] = sNever; //any queued events are now stale.
+	mPersisting[neu] = 0;
+	mPersistenceLapsed[neu] = 0;
+	const_cast< Neuron* >(neuron)->mSheath.mGlia = NULL;
+}
+
+void Glia::Forget(const Dendrite* dendrite)
+{
+	LockThread();
+	mDendritesToMirror.erase(
+		::std::remove(
+			mDendritesToMirror.begin(),
+			mDendritesToMirror.end(),
+			dendrite
+		),
+		mDendritesToMirror.end());
+	if (dendrite && dendrite->mSheath.mGlia == this && dendrite->mSheath.mIndex == sNowhere)
+	{
+		for (
+			::std::size_t den = 0;
+			den < mNewDendrites.size();
+			++den
+			)
+		{
+			if (mNewDendrites[den].second == dendrite)
+			{
+				mNewDendrites.erase(mNewDendrites.begin() + den);
+				break;
+			}
+		}
+		UnlockThread();
+		const_cast< Dendrite* >(dendrite)->mSheath.mGlia = NULL;
+		return;
+	}
+	UnlockThread();
+	if (!dendrite || dendrite->mSheath.mGlia != this || dendrite->mSheath.mIndex >= mDendrites.size() || mDendrites[dendrite->mSheath.mIndex] != dendrite)
+	{
+		return;
+	}
+	const ::std::size_t den = dendrite->mSheath.mIndex;
+
+	mDendrites[den] = NULL;
+	mDendriteStates[den] = 0; //never pending.
+	mDendriteDeadlines[den] = sNever; //any timers are now stale.
+	const_cast< Dendrite* >(dendrite)->mSheath.mGlia = NULL;
+}
+
+/**
+ * @return whether or not a Dendrite with the given mirrored values might have something to process at the given time.
+ * This is deliberately generous (e.g. ignoring Features); the Neuron will check each pending Dendrite properly.
+ */
+static inline uint8_t DendriteIsPending(
+	uint8_t ready,
+	uint8_t potentiated,
+	Timestamp potentiateAt,
+	Timestamp depotentiateAt,
+	Timestamp now
+)
+{
+	return (ready & (potentiated | (now >= potentiateAt))) | (potentiated & (now >= depotentiateAt));
+}
+
+void Glia::Forget(const Axon* axon)
+{
+	if (!axon || axon->mSheath.mGlia != this)
+	{
+		return;
+	}
+	LockThread();
+	if (axon->mSheath.mIndex == sNowhere)
+	{
+		for (
+			::std::size_t axn = 0;
+			axn < mNewAxons.size();
+			++axn
+			)
+		{
+			if (mNewAxons[axn].second == axon)
+			{
+				mNewAxons.erase(mNewAxons.begin() + axn);
+				break;
+			}
+		}
+	}
+	else if (axon->mSheath.mIndex < mAxons.size() && mAxons[axon->mSheath.mIndex] == axon)
+	{
+		mAxons[axon->mSheath.mIndex] = NULL;
+	}
+	UnlockThread();
+	const_cast< Axon* >(axon)->mSheath.mGlia = NULL;
+}
+
+::std::size_t Glia::GetAxons(
+	const Neuron* neuron,
+	::std::vector< Axon* >& axons
+) const
+{
+	if (!neuron || neuron->mSheath.mGlia != this || neuron->mSheath.mIndex >= mNeurons.size() || mNeurons[neuron->mSheath.mIndex] != neuron)
+	{
+		return 0;
+	}
+	const ::std::size_t neu = neuron->mSheath.mIndex;
+	const ::std::size_t had = axons.size();
+
+	LockThread();
+	axons.insert(
+		axons.end(),
+		mAxons.begin() + mAxonOffsets[neu],
+		mAxons.begin() + mAxonOffsets[neu + 1]
+	);
+	for (
+		::std::size_t axn = 0;
+		axn < mNewAxons.size();
+		++axn
+		)
+	{
+		if (mNewAxons[axn].first == neu)
+		{
+			axons.push_back(mNewAxons[axn].second);
+		}
+	}
+	UnlockThread();
+
+	return axons.size() - had;
+}
+
+::std::size_t Glia::Tick(Timestamp now)
+{
+	::std::size_t ret = 0;
+
+	//This is the only place the contiguous arrays are restructured, so nothing else may Grow() them mid-Tick.
+	Grow();
+	ApplyMirrorRequests();
+
+	if (mEventDriven)
+	{
+		//Only check the Dendrites whose deadlines have passed and only visit the Neurons which own them.
+		LockThread();
+		mWheel.Advance(now, mExpired);
+		for (
+			::std::size_t exp = 0;
+			exp < mExpired.size();
+			++exp
+			)
+		{
+			const Timestamp when = mExpired[exp].first;
+			const ::std::size_t item = mExpired[exp].second;
+			::std::size_t neu;
+			if (item & 1)
+			{
+				neu = item >> 1;
+				if (mNextEvents[neu] != when) //stale.
+				{
+					continue;
+				}
+				mNextEvents[neu] = sNever;
+			}
+			else
+			{
+				const ::std::size_t den = item >> 1;
+				if (mDendriteDeadlines[den] != when) //stale.
+				{
+					continue;
+				}
+				mDendriteDeadlines[den] = sNever;
+				mPending[den] = DendriteIsPending(
+					(mDendriteStates[den] & sReady) != 0,
+					(mDendriteStates[den] & sPotentiated) != 0,
+					mPotentiateAt[den],
+					mDepotentiateAt[den],
+					now
+				);
+				mFired.push_back(den);
+				neu = mDendriteOwners[den];
+			}
+			if (!mDue[neu])
+			{
+				mDue[neu] = 1;
+				mArrivals.push_back(neu);
+			}
+		}
+		mExpired.clear();
+		UnlockThread();
+
+		const FiringCondition fallingEdge = firing_condition::FallingEdge();
+		for (
+			::std::size_t arr = 0;
+			arr < mArrivals.size();
+			++arr
+			)
+		{
+			const ::std::size_t neu = mArrivals[arr];
+			mDue[neu] = 0;
+			if (!mNeurons[neu])
+			{
+				continue;
+			}
+			const uint8_t stillPersisting = now < mLastActive[neu] + mPersistFor[neu];
+			mPersistenceLapsed[neu] |= mPersisting[neu] & !stillPersisting & !(mFiringReasons[neu] == fallingEdge);
+			mPersisting[neu] = stillPersisting;
+
+			if (Process(neu, now))
+			{
+				++ret;
+			}
+			if (mPersisting[neu])
+			{
+				Schedule(neu, mLastActive[neu] + mPersistFor[neu]);
+			}
+		}
+
+		//Dendrites that were Processed have already been Mirrored; this re-arms the rest.
+		//Deadlines up to now have been handled, so only later ones are re-armed.
+		for (
+			::std::size_t fir = 0;
+			fir < mFired.size();
+			++fir
+			)
+		{
+			if (mNeurons[mDendriteOwners[mFired[fir]]])
+			{
+				ScheduleDendrite(
+					mFired[fir],
+					now + 1
+				);
+			}
+		}
+		mArrivals.clear();
+		mFired.clear();
+	}
+	else
+	{
+		const ::std::size_t numNeurons = mNeurons.size();
+		const ::std::size_t numDendrites = mDendrites.size();
+
+		//Pass 1: which Dendrites might have something to process.
+		if (numDendrites)
+		{
+			const uint8_t* states = &mDendriteStates[0];
+			const Timestamp* potentiateAt = &mPotentiateAt[0];
+			const Timestamp* depotentiateAt = &mDepotentiateAt[0];
+			uint8_t* pending = &mPending[0];
+			for (
+				::std::size_t den = 0;
+				den < numDendrites;
+				++den
+				)
+			{
+				pending[den] = DendriteIsPending(
+					(states[den] & sReady) != 0,
+					(states[den] & sPotentiated) != 0,
+					potentiateAt[den],
+					depotentiateAt[den],
+					now
+				);
+			}
+		}
+
+		//Pass 2: which Neurons are due & which have stopped persisting.
+		if (numNeurons)
+		{
+			const FiringCondition fallingEdge = firing_condition::FallingEdge();
+			const Milliseconds* intervals = &mIntervals[0];
+			const Timestamp* lastCrests = &mLastCrests[0];
+			const Timestamp* lastActive = &mLastActive[0];
+			const Milliseconds* persistFor = &mPersistFor[0];
+			const FiringCondition* firingReasons = &mFiringReasons[0];
+			uint8_t* persisting = &mPersisting[0];
+			uint8_t* lapsed = &mPersistenceLapsed[0];
+			uint8_t* due = &mDue[0];
+			for (
+				::std::size_t neu = 0;
+				neu < numNeurons;
+				++neu
+				)
+			{
+				const uint8_t stillPersisting = now < lastActive[neu] + persistFor[neu];
+				lapsed[neu] |= persisting[neu] & !stillPersisting & !(firingReasons[neu] == fallingEdge);
+				persisting[neu] = stillPersisting;
+				due[neu] = intervals[neu] + lastCrests[neu] <= now;
+			}
+		}
+
+		//Pass 3: call into only those Neurons that have work to do.
+		for (
+			::std::size_t neu = 0;
+			neu < numNeurons;
+			++neu
+			)
+		{
+			if (mDue[neu] && Process(neu, now))
+			{
+				++ret;
+			}
+		}
+	}
+
+	for (
+		::std::size_t cel = 0;
+		cel < mSupported.size();
+		++cel
+		)
+	{
+		mSupported[cel]->CheckIn();
+	}
+
+	return ret;
+}
+
+bool Glia::Process(::std::size_t neu, Timestamp now)
+{
+	Neuron* neuron = mNeurons[neu];
+	mLastCrests[neu] = now;
+	neuron->SetLastCrestTimestamp(now);
+
+	bool hasWork = mPersistenceLapsed[neu];
+	for (
+		::std::size_t den = mDendriteOffsets[neu];
+		!hasWork && den < mDendriteOffsets[neu + 1];
+		++den
+		)
+	{
+		hasWork = mPending[den];
+	}
+	if (!hasWork)
+	{
+		return false;
+	}
+
+	mPersistenceLapsed[neu] = 0;
+	neuron->PreCrest();
+	for (
+		::std::size_t den = mDendriteOffsets[neu];
+		den < mDendriteOffsets[neu + 1];
+		++den
+		)
+	{
+		if (!mPending[den])
+		{
+			continue;
+		}
+		mPending[den] = 0;
+		if (!mDendrites[den])
+		{
+			continue;
+		}
+		neuron->ProcessDendrite(mDendrites[den]);
+		MirrorDendrite(
+			den,
+			now + 1
+		);
+	}
+	neuron->StemCell::CheckIn();
+	Mirror(neuron);
+	return true;
+}
+
+void Glia::SetEventDriven(bool eventDriven)
+{
+	if (mEventDriven == eventDriven)
+	{
+		return;
+	}
+	mEventDriven = eventDriven;
+	Reschedule();
+}
+
+bool Glia::IsEventDriven() const
+{
+	return mEventDriven;
+}
+
+void Glia::Schedule(
+	::std::size_t neu,
+	Timestamp when
+)
+{
+	if (!mEventDriven || when == sNever)
+	{
+		return;
+	}
+	LockThread();
+	if (when < mNextEvents[neu])
+	{
+		mNextEvents[neu] = when;
+		mWheel.Schedule((neu << 1) | 1, when);
+	}
+	UnlockThread();
+}
+
+void Glia::ScheduleDendrite(
+	::std::size_t den,
+	Timestamp from
+)
+{
+	if (!mEventDriven)
+	{
+		return;
+	}
+	const Timestamp when = GetNextDeadline(
+		den,
+		from
+	);
+	LockThread();
+	if (when != mDendriteDeadlines[den])
+	{
+		mDendriteDeadlines[den] = when;
+		if (when != sNever)
+		{
+			mWheel.Schedule(den << 1, when);
+		}
+	}
+	UnlockThread();
+}
+
+void Glia::ScheduleNext(::std::size_t neu)
+{
+	if (!mEventDriven || !mNeurons[neu])
+	{
+		return;
+	}
+	if (mPersisting[neu])
+	{
+		Schedule(neu, mLastActive[neu] + mPersistFor[neu]);
+	}
+	for (
+		::std::size_t den = mDendriteOffsets[neu];
+		den < mDendriteOffsets[neu + 1];
+		++den
+		)
+	{
+		ScheduleDendrite(den);
+	}
+}
+
+void Glia::Reschedule()
+{
+	LockThread();
+	mWheel.Clear();
+	for (
+		::std::size_t neu = 0;
+		neu < mNextEvents.size();
+		++neu
+		)
+	{
+		mNextEvents[neu] = sNever;
+		mDue[neu] = 0;
+	}
+	for (
+		::std::size_t den = 0;
+		den < mDendriteDeadlines.size();
+		++den
+		)
+	{
+		mDendriteDeadlines[den] = sNever;
+	}
+	UnlockThread();
+
+	if (!mEventDriven)
+	{
+		return;
+	}
+	for (
+		::std::size_t neu = 0;
+		neu < mNeurons.size();
+		++neu
+		)
+	{
+		ScheduleNext(neu);
+	}
+}
+
+Timestamp Glia::GetNextDeadline(
+	::std::size_t den,
+	Timestamp from
+) const
+{
+	Timestamp ret = sNever;
+	if ((mDendriteStates[den] & sReady) && mPotentiateAt[den] >= from)
+	{
+		ret = mPotentiateAt[den];
+	}
+	if ((mDendriteStates[den] & sPotentiated) && mDepotentiateAt[den] >= from && mDepotentiateAt[den] < ret)
+	{
+		ret = mDepotentiateAt[den];
+	}
+	return ret;
+}
+
+::std::size_t Glia::GetNumberOfNeurons() const
+{
+	return mNeurons.size();
+}
+
+::std::size_t Glia::GetNumberOfDendrites() const
+{
+	return mDendrites.size();
+}
+
+::std::size_t Glia::GetNumberOfAxons() const
+{
+	LockThread();
+	const ::std::size_t ret = mAxons.size();
+	UnlockThread();
+	return ret;
+}
+
+} //neural namespace
+} //bio namespace
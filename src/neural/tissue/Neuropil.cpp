@@ -22,13 +22,116 @@
 #include "bio/neural/tissue/Neuropil.h"
 #include "bio/neural/cell/Neuron.h"
 #include "bio/neural/protein/AxonGuide.h"
+#include "bio/neural/tissue/Glia.h"
 
 namespace bio {
 namespace neural {
 
+void Neuropil::CommonConstructor()
+{
+	mcGlia = NULL;
+	mBatchedRevision = 0;
+}
+
 Neuropil::~Neuropil()
 {
+	Unbatch();
+}
+
+Code Neuropil::Crest()
+{
+	return Tissue::Crest();
+}
+
+Code Neuropil::Apoptose()
+{
+	return Tissue::Apoptose();
+}
+
+bool Neuropil::CheckIn()
+{
+	if (!mcGlia)
+	{
+		return Tissue::CheckIn();
+	}
+
+	if (mBatchedRevision != GetRevision< cellular::Cell* >())
+	{
+		//Cells have been added or removed.
+		Batch(mcGlia->IsEventDriven());
+	}
+
+	mcGlia->Tick(physical::GetCurrentTimestamp());
+
+	Container* tissues = GetAll< cellular::Tissue* >();
+	if (tissues)
+	{
+		for (
+			SmartIterator tis = tissues->Begin();
+			!tis.IsAfterEnd();
+			++tis
+			)
+		{
+			tis.As< cellular::Tissue* >()->CheckIn();
+		}
+	}
+
+	return physical::Periodic::CheckIn();
+}
+
+Code Neuropil::Batch(bool eventDriven)
+{
+	if (mcGlia)
+	{
+		mcGlia->Clear();
+	}
+	else
+	{
+		mcGlia = new Glia();
+	}
+	mcGlia->SetEventDriven(eventDriven);
 
+	Code ret = code::Success();
+	Container* cells = GetAll< cellular::Cell* >();
+	BIO_SANITIZE(cells, , return code::CouldNotFindValue1())
+	cellular::Cell* cell;
+	Neuron* neuron;
+	for (
+		SmartIterator cel = cells->Begin();
+		!cel.IsAfterEnd();
+		++cel
+		)
+	{
+		cell = cel.As< cellular::Cell* >();
+		neuron = ChemicalCast< Neuron* >(cell);
+		if (!neuron)
+		{
+			mcGlia->Support(cell);
+			continue;
+		}
+		if (!mcGlia->Ensheathe(neuron) && ret == code::Success())
+		{
+			ret = code::UnknownError();
+		}
+	}
+	mBatchedRevision = GetRevision< cellular::Cell* >();
+	return ret;
+}
+
+void Neuropil::Unbatch()
+{
+	if (!mcGlia)
+	{
+		return;
+	}
+	delete mcGlia;
+	mcGlia = NULL;
+	mBatchedRevision = 0;
+}
+
+bool Neuropil::IsBatched() const
+{
+	return mcGlia != NULL;
 }
 
 Code Neuropil::CacheProteins()
@@ -187,7 +290,8 @@ Synapses Neuropil::Connect(
 	guide->Fold();
 	(*guide)();
 	
-	Synapses ret = guide->RotateTo(synapsesBindingSite)->Probe< Synapses >();
+	const molecular::Surface* synapses = guide->RotateTo(synapsesBindingSite);
+	Synapses ret = synapses->Probe< Synapses >();
 
 	guide->RotateTo(presynapticNeuropilBindingSite)->Release();
 	guide->RotateTo(postsynapticNeuropilBindingSite)->Release();
@@ -21,8 +21,42 @@
 
 #include "bio/physical/affinity/Affinity.h"
 
+#include <algorithm>
+
 namespace bio {
 
+namespace {
+
+/**
+ * Orders indices by the Strength at each index, strongest first. <br />
+ * Ties keep their original order. <br />
+ */
+class StrongerThan
+{
+public:
+	StrongerThan(const ::std::vector< Affinity::Strength >& strengths) :
+		mStrengths(strengths)
+	{
+	}
+
+	bool operator()(
+		::std::size_t lhs,
+		::std::size_t rhs
+	) const
+	{
+		if (mStrengths[lhs] != mStrengths[rhs])
+		{
+			return mStrengths[lhs] > mStrengths[rhs];
+		}
+		return lhs < rhs;
+	}
+
+private:
+	const ::std::vector< Affinity::Strength >& mStrengths;
+};
+
+} //anonymous namespace
+
 Affinity::~Affinity()
 {
 
@@ -45,4 +79,79 @@ bool Affinity::operator==(const Wave* wave) const
 	return AttractionExists(wave);
 }
 
+void Affinity::GetStrengthsOfAttractionTo(
+	const Wave* const* waves,
+	::std::size_t count,
+	Affinity::Strength* strengths
+) const
+{
+	for (
+		::std::size_t wav = 0;
+		wav < count;
+		++wav
+		)
+	{
+		strengths[wav] = GetStrengthOfAttractionTo(waves[wav]);
+	}
+}
+
+::std::size_t Affinity::Select(
+	const Wave* const* waves,
+	::std::size_t count,
+	::std::vector< ::std::size_t >& selected,
+	::std::size_t limit,
+	Affinity::Strength threshold
+) const
+{
+	selected.clear();
+	if (!count)
+	{
+		return 0;
+	}
+	BIO_SANITIZE(waves, , return 0)
+
+	for (
+		::std::size_t wav = 0;
+		wav < count;
+		++wav
+		)
+	{
+		if (AttractionExists(waves[wav], threshold))
+		{
+			selected.push_back(wav);
+		}
+	}
+
+	if (limit && selected.size() > 1)
+	{
+		//Only the selected Waves need to be ranked.
+		::std::vector< Strength > strengths(count);
+		for (
+			::std::size_t sel = 0;
+			sel < selected.size();
+			++sel
+			)
+		{
+			strengths[selected[sel]] = GetStrengthOfAttractionTo(waves[selected[sel]]);
+		}
+		if (selected.size() > limit)
+		{
+			::std::partial_sort(
+				selected.begin(),
+				selected.begin() + limit,
+				selected.end(),
+				StrongerThan(strengths));
+			selected.resize(limit);
+		}
+		else
+		{
+			::std::sort(
+				selected.begin(),
+				selected.end(),
+				StrongerThan(strengths));
+		}
+	}
+	return selected.size();
+}
+
 } //bio namespace
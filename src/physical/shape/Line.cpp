@@ -28,7 +28,8 @@ namespace physical {
 Line::Line(Index expectedSize)
 	:
 	Arrangement< Linear >(expectedSize),
-	mTempItt(NULL)
+	mTempItt(NULL),
+	mIdIndexIsStale(true)
 {
 
 }
@@ -36,7 +37,8 @@ Line::Line(Index expectedSize)
 Line::Line(const Container* other)
 	:
 	Arrangement< Linear >(other),
-	mTempItt(NULL)
+	mTempItt(NULL),
+	mIdIndexIsStale(true) //other was Imported before *this could index it.
 {
 
 }
@@ -72,25 +74,133 @@ const Identifiable< Id >* Line::LinearAccess(Index index) const
 
 Index Line::SeekToName(const Name& name) const
 {
-	if (!mTempItt)
+	if (!GetNumberOfElements())
 	{
-		mTempItt = ConstructClassIterator();
+		return InvalidIndex();
 	}
-	mTempItt->MoveTo(GetEndIndex());
+	Perspective< Id >* perspective = LinearAccess(GetEndIndex())->GetPerspective();
+	if (!perspective)
+	{
+		return ScanForName(name);
+	}
+	const Id id = perspective->GetIdWithoutCreation(name);
+	if (id != Perspective< Id >::InvalidId())
+	{
+		Index ret = SeekToId(id);
+		if (ret != InvalidIndex())
+		{
+			return ret;
+		}
+	}
+
+	//Contents may not share the last element's Perspective or may have been renamed behind our back.
+	return ScanForName(name);
+}
+
+Index Line::SeekToId(const Id& id) const
+{
+	IndexIds();
+	IdIndex::const_iterator found = mIdIndex.find(id);
+	if (found == mIdIndex.end())
+	{
+		return InvalidIndex();
+	}
+	if (IsAllocated(found->second) && LinearAccess(found->second)->IsId(id))
+	{
+		return found->second;
+	}
+
+	//Something changed its Id behind our back.
+	mIdIndexIsStale = true;
+	IndexIds();
+	found = mIdIndex.find(id);
+	if (found == mIdIndex.end())
+	{
+		return InvalidIndex();
+	}
+	return found->second;
+}
+
+Index Line::Add(const ByteStream content)
+{
+	Index ret = Arrangement< Linear >::Add(content);
+	if (!mIdIndexIsStale && IsAllocated(ret))
+	{
+		const Id id = LinearAccess(ret)->GetId();
+		IdIndex::iterator found = mIdIndex.find(id);
+		if (found == mIdIndex.end())
+		{
+			mIdIndex.insert(::std::make_pair(id, ret));
+		}
+		else if (found->second < ret)
+		{
+			found->second = ret;
+		}
+	}
+	return ret;
+}
+
+Index Line::Insert(
+	const ByteStream content,
+	const Index index
+)
+{
+	Index ret = Arrangement< Linear >::Insert(
+		content,
+		index
+	);
+	mIdIndexIsStale = true;
+	return ret;
+}
+
+ByteStream Line::Erase(Index index)
+{
+	if (!mIdIndexIsStale && IsAllocated(index))
+	{
+		//Another element may share the Id, so let IndexIds() find it.
+		IdIndex::const_iterator found = mIdIndex.find(LinearAccess(index)->GetId());
+		if (found != mIdIndex.end() && found->second == index)
+		{
+			mIdIndexIsStale = true;
+		}
+	}
+	return Arrangement< Linear >::Erase(index);
+}
+
+void Line::Clear()
+{
+	Arrangement< Linear >::Clear();
+	mIdIndex.clear();
+	mIdIndexIsStale = false;
+}
+
+void Line::InvalidateIdIndex()
+{
+	mIdIndexIsStale = true;
+}
+
+void Line::IndexIds() const
+{
+	if (!mIdIndexIsStale)
+	{
+		return;
+	}
+	mIdIndex.clear();
 	for (
-		; !mTempItt->IsBeforeBeginning();
-		mTempItt->Decrement()
+		Index idx = GetBeginIndex();
+		idx <= GetEndIndex();
+		++idx
 		)
 	{
-		if (LinearAccess(mTempItt->GetIndex())->IsName(name))
+		if (IsAllocated(idx))
 		{
-			return mTempItt->GetIndex();
+			mIdIndex[LinearAccess(idx)->GetId()] = idx;
 		}
 	}
-	return InvalidIndex();
+	mIdIndexIsStale = false;
 }
 
-Index Line::SeekToId(const Id& id) const
+Index Line::ScanForName(const Name& name) const
 {
 	if (!mTempItt)
 	{
@@ -102,7 +212,7 @@ Index Line::SeekToId(const Id& id) const
 		mTempItt->Decrement()
 		)
 	{
-		if (LinearAccess(mTempItt->GetIndex())->IsId(id))
+		if (LinearAccess(mTempItt->GetIndex())->IsName(name))
 		{
 			return mTempItt->GetIndex();
 		}
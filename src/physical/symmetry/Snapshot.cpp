@@ -0,0 +1,784 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2023 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "bio/physical/symmetry/Snapshot.h"
+#include "bio/common/macro/OSMacros.h"
+
+#include <cstdio>
+#include <cstring>
+
+#ifdef BIO_OS_IS_LINUX
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace bio {
+namespace physical {
+
+static const char sMagic[4] = {'B', 'I', 'O', 'S'};
+
+static void Put(
+	::std::vector< char >& out,
+	const void* bytes,
+	::std::size_t size
+)
+{
+	const char* begin = static_cast< const char* >(bytes);
+	out.insert(
+		out.end(),
+		begin,
+		begin + size
+	);
+}
+
+static void PutNumber(
+	::std::vector< char >& out,
+	uint32_t number
+)
+{
+	Put(
+		out,
+		&number,
+		sizeof(number));
+}
+
+static void PutString(
+	::std::vector< char >& out,
+	const char* string,
+	::std::size_t size
+)
+{
+	PutNumber(
+		out,
+		uint32_t(size));
+	Put(
+		out,
+		string,
+		size
+	);
+}
+
+static void PutString(
+	::std::vector< char >& out,
+	const Name& string
+)
+{
+	const char* chars = string ? string.AsCharString() : "";
+	PutString(
+		out,
+		chars,
+		::std::strlen(chars));
+}
+
+/**
+ * Reads what Put... wrote. <br />
+ * Once any read runs past mEnd, mFailed is set and every later read yields 0 or "". <br />
+ */
+struct Reader
+{
+	Reader(
+		const char* begin,
+		const char* end
+	)
+		:
+		mPosition(begin),
+		mEnd(end),
+		mFailed(false)
+	{
+	}
+
+	const char* Take(::std::size_t size)
+	{
+		if (mFailed || ::std::size_t(mEnd - mPosition) < size)
+		{
+			mFailed = true;
+			return NULL;
+		}
+		const char* ret = mPosition;
+		mPosition += size;
+		return ret;
+	}
+
+	uint32_t GetNumber()
+	{
+		uint32_t ret = 0;
+		const char* bytes = Take(sizeof(ret));
+		if (bytes)
+		{
+			::std::memcpy(
+				&ret,
+				bytes,
+				sizeof(ret));
+		}
+		return ret;
+	}
+
+	const char* GetBytes(uint32_t& size)
+	{
+		size = GetNumber();
+		return Take(size);
+	}
+
+	::std::string GetString()
+	{
+		uint32_t size;
+		const char* bytes = GetBytes(size);
+		if (!bytes)
+		{
+			return ::std::string();
+		}
+		return ::std::string(
+			bytes,
+			size
+		);
+	}
+
+	const char* mPosition;
+	const char* mEnd;
+	bool mFailed;
+};
+
+/*static*/ uint32_t Snapshot::Version()
+{
+	return 2;
+}
+
+/*static*/ Index Snapshot::NoParent()
+{
+	return Index(-1);
+}
+
+Snapshot::Link::Link(
+	uint32_t kind,
+	uint32_t id,
+	uint32_t type,
+	uint32_t ofClass
+)
+	:
+	mKind(kind),
+	mId(id),
+	mType(type),
+	mClass(ofClass)
+{
+
+}
+
+Snapshot::Snapshot()
+	:
+	mInPlace(NULL),
+	mInPlaceSize(0),
+	mMapping(NULL),
+	mMappingSize(0),
+	mSymmetries(NULL)
+{
+
+}
+
+Snapshot::~Snapshot()
+{
+	Clear();
+}
+
+void Snapshot::Clear()
+{
+	mTables.clear();
+	mEntries.clear();
+	mRecords.clear();
+	if (mSymmetries)
+	{
+		delete[] mSymmetries;
+		mSymmetries = NULL;
+	}
+	mInPlace = NULL;
+	mInPlaceSize = 0;
+	#ifdef BIO_OS_IS_LINUX
+	if (mMapping)
+	{
+		::munmap(
+			mMapping,
+			mMappingSize
+		);
+	}
+	#endif
+	mMapping = NULL;
+	mMappingSize = 0;
+	mFile.clear();
+}
+
+const char* Snapshot::GetRecords() const
+{
+	if (mInPlace)
+	{
+		return mInPlace;
+	}
+	return mRecords.empty() ? NULL : &mRecords[0];
+}
+
+::std::size_t Snapshot::GetSizeOfRecords() const
+{
+	if (mInPlace)
+	{
+		return mInPlaceSize;
+	}
+	return mRecords.size();
+}
+
+Name Snapshot::GetString(
+	uint32_t at,
+	uint32_t size
+) const
+{
+	if (!size)
+	{
+		return NULL;
+	}
+	return ::std::string(
+		GetRecords() + at,
+		size
+	);
+}
+
+void Snapshot::OwnRecords()
+{
+	if (!mInPlace)
+	{
+		return;
+	}
+	mRecords.assign(
+		mInPlace,
+		mInPlace + mInPlaceSize
+	);
+	mInPlace = NULL;
+	mInPlaceSize = 0;
+}
+
+Index Snapshot::Record(
+	const Symmetry* symmetry,
+	Index parent,
+	Id id,
+	const Name& name,
+	const Link& link
+)
+{
+	OwnRecords();
+
+	Entry entry;
+	entry.mParent = parent;
+	entry.mId = id;
+	entry.mLink = link;
+	entry.mSymmetry = NoParent();
+	entry.mSymmetryName = 0;
+	entry.mSymmetryNameSize = 0;
+
+	::std::size_t lengthAt = mRecords.size();
+	PutNumber(
+		mRecords,
+		0); //length, filled in below.
+	PutNumber(
+		mRecords,
+		parent
+	);
+	PutNumber(
+		mRecords,
+		id.mT
+	);
+	entry.mName = uint32_t(mRecords.size() + sizeof(uint32_t));
+	PutString(
+		mRecords,
+		name
+	);
+	entry.mNameSize = uint32_t(mRecords.size() - entry.mName);
+	PutNumber(
+		mRecords,
+		link.mKind
+	);
+	PutNumber(
+		mRecords,
+		link.mId
+	);
+	PutNumber(
+		mRecords,
+		link.mType
+	);
+	PutNumber(
+		mRecords,
+		link.mClass
+	);
+	PutNumber(
+		mRecords,
+		symmetry != NULL
+	);
+	if (symmetry)
+	{
+		entry.mSymmetryName = uint32_t(mRecords.size() + sizeof(uint32_t));
+		PutString(
+			mRecords,
+			symmetry->GetName());
+		entry.mSymmetryNameSize = uint32_t(mRecords.size() - entry.mSymmetryName);
+		PutString(
+			mRecords,
+			symmetry->GetType().GetName());
+		PutString(
+			mRecords,
+			symmetry->GetValue().GetTypeName());
+		const ByteStream& value = symmetry->GetValue();
+		PutString(
+			mRecords,
+			value.IsEmpty() ? "" : static_cast< const char* >(const_cast< ByteStream& >(value).DirectAccess()),
+			value.IsEmpty() ? 0 : value.GetSize());
+	}
+	uint32_t length = uint32_t(mRecords.size() - lengthAt - sizeof(uint32_t));
+	::std::memcpy(
+		&mRecords[lengthAt],
+		&length,
+		sizeof(length));
+
+	mEntries.push_back(entry);
+	return Index(mEntries.size() - 1);
+}
+
+void Snapshot::Encode(::std::vector< char >& out) const
+{
+	Put(
+		out,
+		sMagic,
+		sizeof(sMagic));
+	PutNumber(
+		out,
+		Version());
+	PutNumber(
+		out,
+		uint32_t(mTables.size()));
+	PutNumber(
+		out,
+		uint32_t(mEntries.size()));
+
+	::std::vector< char > table;
+	for (
+		::std::size_t tbl = 0;
+		tbl < mTables.size();
+		++tbl
+		)
+	{
+		table.clear();
+		PutString(
+			table,
+			mTables[tbl].mName.c_str(),
+			mTables[tbl].mName.size());
+		PutNumber(
+			table,
+			uint32_t(mTables[tbl].mNames.size()));
+		for (
+			::std::size_t nam = 0;
+			nam < mTables[tbl].mNames.size();
+			++nam
+			)
+		{
+			PutString(
+				table,
+				mTables[tbl].mNames[nam].c_str(),
+				mTables[tbl].mNames[nam].size());
+		}
+		PutString(
+			out,
+			table.empty() ? NULL : &table[0],
+			table.size());
+	}
+
+	Put(
+		out,
+		GetRecords(),
+		GetSizeOfRecords());
+}
+
+Code Snapshot::Write(const char* path) const
+{
+	BIO_SANITIZE(path, ,
+		return code::BadArgument1())
+
+	::std::vector< char > bytes;
+	Encode(bytes);
+
+	::std::FILE* file = ::std::fopen(
+		path,
+		"wb"
+	);
+	if (!file)
+	{
+		return code::GeneralFailure();
+	}
+	bool written = ::std::fwrite(
+		&bytes[0],
+		1,
+		bytes.size(),
+		file
+	) == bytes.size();
+	written = (::std::fclose(file) == 0) && written;
+	return written ? code::Success() : code::GeneralFailure();
+}
+
+Code Snapshot::Read(const char* path)
+{
+	Clear();
+	BIO_SANITIZE(path, ,
+		return code::BadArgument1())
+
+	#ifdef BIO_OS_IS_LINUX
+	int file = ::open(
+		path,
+		O_RDONLY
+	);
+	if (file < 0)
+	{
+		return code::CouldNotFindValue1();
+	}
+	struct stat status;
+	if (::fstat(
+		file,
+		&status
+	) != 0 || status.st_size <= 0)
+	{
+		::close(file);
+		return code::BadArgument1();
+	}
+	::std::size_t size = ::std::size_t(status.st_size);
+	void* mapped = ::mmap(
+		NULL,
+		size,
+		PROT_READ,
+		MAP_PRIVATE,
+		file,
+		0
+	);
+	::close(file);
+	if (mapped == MAP_FAILED)
+	{
+		return code::GeneralFailure();
+	}
+	Code ret = Parse(
+		static_cast< const char* >(mapped),
+		size,
+		true
+	);
+	if (ret != code::Success())
+	{
+		::munmap(
+			mapped,
+			size
+		);
+		return ret;
+	}
+	mMapping = mapped; //our records point into the mapping, so it stays until we Clear().
+	mMappingSize = size;
+	return ret;
+	#else
+	::std::FILE* file = ::std::fopen(
+		path,
+		"rb"
+	);
+	if (!file)
+	{
+		return code::CouldNotFindValue1();
+	}
+	::std::vector< char > bytes;
+	char buffer[4096];
+	::std::size_t got;
+	while ((got = ::std::fread(
+		buffer,
+		1,
+		sizeof(buffer),
+		file
+	)) > 0)
+	{
+		bytes.insert(
+			bytes.end(),
+			buffer,
+			buffer + got
+		);
+	}
+	::std::fclose(file);
+	if (bytes.empty())
+	{
+		return code::BadArgument1();
+	}
+	Code ret = Parse(
+		&bytes[0],
+		bytes.size(),
+		true
+	);
+	if (ret == code::Success())
+	{
+		mFile.swap(bytes); //our records point into these bytes, so they stay until we Clear().
+	}
+	return ret;
+	#endif
+}
+
+Code Snapshot::Load(
+	const char* bytes,
+	::std::size_t size
+)
+{
+	Clear();
+	return Parse(
+		bytes,
+		size,
+		false
+	);
+}
+
+Code Snapshot::Parse(
+	const char* bytes,
+	::std::size_t size,
+	bool inPlace
+)
+{
+	BIO_SANITIZE(bytes, ,
+		return code::BadArgument1())
+
+	Reader header(
+		bytes,
+		bytes + size
+	);
+	const char* magic = header.Take(sizeof(sMagic));
+	if (!magic || ::std::memcmp(
+		magic,
+		sMagic,
+		sizeof(sMagic)) != 0 || header.GetNumber() != Version())
+	{
+		return code::BadArgument1();
+	}
+	uint32_t numTables = header.GetNumber();
+	uint32_t numRecords = header.GetNumber();
+	if (header.mFailed || ::std::size_t(header.mEnd - header.mPosition) / sizeof(uint32_t) < ::std::size_t(numTables) + numRecords)
+	{
+		return code::BadArgument1();
+	}
+
+	mTables.resize(numTables);
+	for (
+		uint32_t tbl = 0;
+		tbl < numTables && !header.mFailed;
+		++tbl
+		)
+	{
+		uint32_t length = header.GetNumber();
+		const char* body = header.Take(length);
+		if (!body)
+		{
+			break;
+		}
+		Reader table(
+			body,
+			body + length
+		);
+		mTables[tbl].mName = table.GetString();
+		uint32_t numNames = table.GetNumber();
+		for (
+			uint32_t nam = 0;
+			nam < numNames && !table.mFailed;
+			++nam
+			)
+		{
+			mTables[tbl].mNames.push_back(table.GetString());
+		}
+		header.mFailed = table.mFailed;
+	}
+	if (header.mFailed)
+	{
+		Clear();
+		return code::BadArgument1();
+	}
+
+	//All remaining bytes are records, which are kept as they are, so that *this can be Written again.
+	if (inPlace)
+	{
+		mInPlace = header.mPosition;
+		mInPlaceSize = ::std::size_t(header.mEnd - header.mPosition);
+	}
+	else
+	{
+		mRecords.assign(
+			header.mPosition,
+			header.mEnd
+		);
+	}
+	const char* begin = GetRecords();
+
+	mSymmetries = new Symmetry[numRecords];
+	mEntries.resize(numRecords);
+	Reader records(
+		begin,
+		begin + GetSizeOfRecords());
+	for (
+		uint32_t rcd = 0;
+		rcd < numRecords;
+		++rcd
+		)
+	{
+		uint32_t length = records.GetNumber();
+		const char* body = records.Take(length);
+		if (!body)
+		{
+			break;
+		}
+		Reader record(
+			body,
+			body + length
+		);
+		Entry& entry = mEntries[rcd];
+		entry.mParent = record.GetNumber();
+		entry.mId = record.GetNumber();
+		const char* name = record.GetBytes(entry.mNameSize);
+		entry.mName = name ? uint32_t(name - begin) : 0;
+		entry.mLink.mKind = record.GetNumber();
+		entry.mLink.mId = record.GetNumber();
+		entry.mLink.mType = record.GetNumber();
+		entry.mLink.mClass = record.GetNumber();
+		entry.mSymmetry = NoParent();
+		entry.mSymmetryName = 0;
+		entry.mSymmetryNameSize = 0;
+		if (record.GetNumber())
+		{
+			Symmetry& symmetry = mSymmetries[rcd];
+			const char* symmetryName = record.GetBytes(entry.mSymmetryNameSize);
+			entry.mSymmetryName = symmetryName ? uint32_t(symmetryName - begin) : 0;
+			uint32_t typeSize;
+			const char* type = record.GetBytes(typeSize);
+			::std::string valueType = record.GetString();
+			uint32_t valueSize = record.GetNumber();
+			const char* value = record.Take(valueSize);
+			//Names are set through their Ids, so that they point to the Names held by the Perspective, rather than to our records.
+			if (symmetryName && entry.mSymmetryNameSize)
+			{
+				symmetry.SetId(SymmetryPerspective::Instance().GetIdFromName(GetString(
+					entry.mSymmetryName,
+					entry.mSymmetryNameSize
+				)));
+			}
+			if (type && typeSize)
+			{
+				symmetry.SetType(SymmetryTypePerspective::Instance().GetIdFromName(::std::string(
+					type,
+					typeSize
+				)));
+			}
+			if (value && valueSize)
+			{
+				symmetry.AccessValue()->Set(
+					value,
+					valueSize,
+					valueType
+				);
+			}
+			entry.mSymmetry = rcd;
+		}
+		if (record.mFailed || (entry.mParent != NoParent() && entry.mParent >= rcd))
+		{
+			records.mFailed = true;
+			break;
+		}
+	}
+	if (records.mFailed || records.mPosition != records.mEnd)
+	{
+		Clear();
+		return code::BadArgument1();
+	}
+	return code::Success();
+}
+
+Index Snapshot::GetNumberOfRecords() const
+{
+	return Index(mEntries.size());
+}
+
+Index Snapshot::GetParent(Index record) const
+{
+	BIO_SANITIZE(record < mEntries.size(), ,
+		return NoParent())
+	return mEntries[record].mParent;
+}
+
+Id Snapshot::GetId(Index record) const
+{
+	BIO_SANITIZE(record < mEntries.size(), ,
+		return 0)
+	return mEntries[record].mId;
+}
+
+Name Snapshot::GetName(Index record) const
+{
+	BIO_SANITIZE(record < mEntries.size(), ,
+		return NULL)
+	return GetString(
+		mEntries[record].mName,
+		mEntries[record].mNameSize
+	);
+}
+
+Snapshot::Link Snapshot::GetLink(Index record) const
+{
+	BIO_SANITIZE(record < mEntries.size(), ,
+		return Link())
+	return mEntries[record].mLink;
+}
+
+const Symmetry* Snapshot::GetSymmetry(Index record) const
+{
+	BIO_SANITIZE(record < mEntries.size(), ,
+		return NULL)
+	if (!mSymmetries || mEntries[record].mSymmetry == NoParent())
+	{
+		return NULL;
+	}
+	return &mSymmetries[mEntries[record].mSymmetry];
+}
+
+Name Snapshot::GetSymmetryName(Index record) const
+{
+	BIO_SANITIZE(record < mEntries.size(), ,
+		return NULL)
+	return GetString(
+		mEntries[record].mSymmetryName,
+		mEntries[record].mSymmetryNameSize
+	);
+}
+
+const Snapshot::Table* Snapshot::GetTable(const Name& table) const
+{
+	for (
+		::std::size_t tbl = 0;
+		tbl < mTables.size();
+		++tbl
+		)
+	{
+		if (table == mTables[tbl].mName)
+		{
+			return &mTables[tbl];
+		}
+	}
+	return NULL;
+}
+
+} //physical namespace
+} //bio namespace
@@ -33,7 +33,8 @@ Symmetry::Symmetry()
 	mType(&SymmetryTypePerspective::Instance()),
 	mTimeCreated(GetCurrentTimestamp()),
 	mTimeUpdated(0),
-	mRealization(NULL)
+	mRealization(NULL),
+	mJournal(NULL)
 {
 
 }
@@ -50,7 +51,8 @@ Symmetry::Symmetry(
 	),
 	mTimeCreated(GetCurrentTimestamp()),
 	mTimeUpdated(0),
-	mRealization(NULL)
+	mRealization(NULL),
+	mJournal(NULL)
 {
 	Identifiable< Id >::Initialize(
 		name,
@@ -69,7 +71,8 @@ Symmetry::Symmetry(
 	),
 	mTimeCreated(GetCurrentTimestamp()),
 	mTimeUpdated(0),
-	mRealization(NULL)
+	mRealization(NULL),
+	mJournal(NULL)
 {
 	Identifiable< Id >::Initialize(
 		name,
@@ -88,7 +91,8 @@ Symmetry::Symmetry(
 	),
 	mTimeCreated(GetCurrentTimestamp()),
 	mTimeUpdated(0),
-	mRealization(NULL)
+	mRealization(NULL),
+	mJournal(NULL)
 {
 	Identifiable< Id >::Initialize(
 		id,
@@ -107,15 +111,56 @@ Symmetry::Symmetry(
 	),
 	mTimeCreated(GetCurrentTimestamp()),
 	mTimeUpdated(0),
-	mRealization(NULL)
+	mRealization(NULL),
+	mJournal(NULL)
 {
 	Identifiable< Id >::Initialize(
 		id,
 		&SymmetryPerspective::Instance());
 }
 
+Symmetry::Symmetry(const Symmetry& toCopy)
+	:
+	Identifiable< Id >(toCopy),
+	Class< Symmetry >(this),
+	mValue(toCopy.mValue),
+	mType(toCopy.mType),
+	mTimeCreated(toCopy.mTimeCreated),
+	mTimeUpdated(toCopy.mTimeUpdated),
+	mRealization(toCopy.mRealization),
+	mJournal(NULL)
+{
+
+}
+
+Symmetry& Symmetry::operator=(const Symmetry& toCopy)
+{
+	if (this == &toCopy)
+	{
+		return *this;
+	}
+	Identifiable< Id >::Initialize(
+		toCopy.GetId(),
+		toCopy.GetPerspective());
+	SetType(toCopy.mType.GetId());
+	mValue = toCopy.mValue;
+	mTimeCreated = toCopy.mTimeCreated;
+	mTimeUpdated = toCopy.mTimeUpdated;
+	mRealization = toCopy.mRealization;
+	//Keep our own mJournal: what Journals *this still needs to know that *this changed.
+	if (mJournal)
+	{
+		mJournal->Note(this);
+	}
+	return *this;
+}
+
 Symmetry::~Symmetry()
 {
+	if (mJournal)
+	{
+		mJournal->Forget(this);
+	}
 }
 
 const Identifiable< SymmetryType >& Symmetry::GetType() const
@@ -136,6 +181,10 @@ void Symmetry::SetType(const Name& type)
 void Symmetry::SetValue(const ByteStream& bytes)
 {
 	mTimeUpdated = GetCurrentTimestamp();
+	if (mJournal)
+	{
+		mJournal->Note(this);
+	}
 	mValue = bytes;
 }
 
@@ -147,6 +196,10 @@ const ByteStream& Symmetry::GetValue() const
 ByteStream* Symmetry::AccessValue()
 {
 	mTimeUpdated = GetCurrentTimestamp();
+	if (mJournal)
+	{
+		mJournal->Note(this);
+	}
 	return &mValue;
 }
 
@@ -171,5 +224,15 @@ void Symmetry::Realize()
 	mRealization->Reify(this);
 }
 
+void Symmetry::SetJournal(Journal* journal)
+{
+	mJournal = journal;
+}
+
+Journal* Symmetry::GetJournal() const
+{
+	return mJournal;
+}
+
 } //physical namespace
 } //bio namespace
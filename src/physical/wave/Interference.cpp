@@ -44,13 +44,12 @@ Superposition Interference::GetSuperpositionFor(const Id &symmetry) const
 
 void Interference::SetSuperpositionFor(const Id &symmetry, const Superposition &superposition)
 {
-	Index index = mSuperSymmetries.SeekToId(symmetry);
-	if (!index)
+	SuperSymmetry* superSymmetry = GetSuperSymmetryFor(symmetry);
+	if (!superSymmetry)
 	{
-		mSuperSymmetries.Add(Linear(new SuperSymmetry(symmetry, superposition)));
+		AddSuperSymmetry(new SuperSymmetry(symmetry, superposition));
+		return;
 	}
-	SuperSymmetry* superSymmetry = GetSuperSymmetryFor(symmetry);
-	BIO_SANITIZE(superSymmetry, , return NULL)
 	superSymmetry->SetSuperposition(superposition);
 }
 
@@ -63,28 +62,92 @@ const Interference* Interference::GetInterferenceFor(const Id& symmetry) const
 
 void Interference::SetInterferenceFor(const Id &symmetry, Interference *interference)
 {
-	Index index = mSuperSymmetries.SeekToId(symmetry);
-	if (!index)
+	SuperSymmetry* superSymmetry = GetSuperSymmetryFor(symmetry);
+	if (!superSymmetry)
 	{
-		mSuperSymmetries.Add(Linear(new SuperSymmetry(symmetry, superposition::Complex(), interference)));
+		AddSuperSymmetry(new SuperSymmetry(symmetry, superposition::Complex(), interference));
+		return;
 	}
-	SuperSymmetry* superSymmetry = GetSuperSymmetryFor(symmetry);
-	BIO_SANITIZE(superSymmetry, , return NULL)
 	superSymmetry->SetInterference(interference);
 }
 
+void Interference::GetSuperpositionsFor(
+	const ConstWaves& waves,
+	::std::vector< Superposition >& superpositions
+) const
+{
+	superpositions.clear();
+	superpositions.reserve(waves.Size());
+
+	//Most batches only hold a few distinct Symmetries, so we remember what we've seen in a small list.
+	::std::vector< ::std::pair< Id, Superposition > > seen;
+	::std::vector< ::std::pair< Id, Superposition > >::const_iterator found;
+	const Wave* wave;
+	const Symmetry* symmetry;
+	for (
+		SmartIterator wav = waves.Begin();
+		!wav.IsAfterEnd();
+		++wav
+		)
+	{
+		wave = wav.As< const Wave* >();
+		symmetry = wave ? wave->GetSymmetry() : NULL;
+		if (!symmetry)
+		{
+			superpositions.push_back(superposition::Noninterfering());
+			continue;
+		}
+		Id id = symmetry->GetId();
+		for (
+			found = seen.begin();
+			found != seen.end() && found->first != id;
+			++found
+			)
+		{
+		}
+		if (found != seen.end())
+		{
+			superpositions.push_back(found->second);
+			continue;
+		}
+		const SuperSymmetry* superSymmetry = GetSuperSymmetryFor(id);
+		Superposition superposition = superSymmetry ? superSymmetry->GetSuperposition() : superposition::Noninterfering();
+		seen.push_back(::std::pair< Id, Superposition >(id, superposition));
+		superpositions.push_back(superposition);
+	}
+}
+
 const SuperSymmetry* Interference::GetSuperSymmetryFor(const Id& symmetry) const
 {
-	Index index = mSuperSymmetries.SeekToId(symmetry);
-	BIO_SANITIZE(index, , return NULL)
-	return ForceCast< const SuperSymmetry* >(mSuperSymmetries.LinearAccess(index));
+	return const_cast< Interference* >(this)->GetSuperSymmetryFor(symmetry);
 }
 
 SuperSymmetry* Interference::GetSuperSymmetryFor(const Id& symmetry)
 {
-	Index index = mSuperSymmetries.SeekToId(symmetry);
-	BIO_SANITIZE(index, , return NULL)
-	return ForceCast< SuperSymmetry* >(mSuperSymmetries.LinearAccess(index));
+	if (symmetry.mT < sMaxDenseSize)
+	{
+		return symmetry.mT < mDenseSuperSymmetries.size() ? mDenseSuperSymmetries[symmetry.mT] : NULL;
+	}
+	::std::map< Id, SuperSymmetry* >::const_iterator found = mSparseSuperSymmetries.find(symmetry);
+	return found == mSparseSuperSymmetries.end() ? NULL : found->second;
+}
+
+void Interference::AddSuperSymmetry(SuperSymmetry* superSymmetry)
+{
+	mSuperSymmetries.Add(Linear(superSymmetry));
+	Id symmetry = superSymmetry->GetId();
+	if (symmetry.mT >= sMaxDenseSize)
+	{
+		mSparseSuperSymmetries[symmetry] = superSymmetry;
+		return;
+	}
+	if (symmetry.mT >= mDenseSuperSymmetries.size())
+	{
+		mDenseSuperSymmetries.resize(
+			symmetry.mT + 1,
+			NULL);
+	}
+	mDenseSuperSymmetries[symmetry.mT] = superSymmetry;
 }
 
 } //physical namespace
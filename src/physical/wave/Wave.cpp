@@ -69,7 +69,10 @@ const Symmetry *Wave::GetSymmetry() const
 
 Code Wave::Reify(const Symmetry *symmetry)
 {
+	BIO_SANITIZE(symmetry && mSymmetry, ,
+		return code::BadArgument1())
 	(*mSymmetry) = *symmetry;
+	mSymmetry->SetRealization(this); //we are still what mSymmetry describes.
 	return code::Success();
 }
 
@@ -239,6 +242,7 @@ bool Wave::Superpose(const Wave* displacement, Interference* pattern)
 	if (pattern->GetSuperpositionFor(mSymmetry->GetId()) == superposition::Noninterfering()) {
 		return true;
 	}
+	BIO_SANITIZE(displacement->GetSymmetry(),,return true)
 	if (pattern->GetSuperpositionFor(displacement->GetSymmetry()->GetId()) == superposition::Noninterfering()) {
 		return true;
 	}
@@ -247,13 +251,33 @@ bool Wave::Superpose(const Wave* displacement, Interference* pattern)
 
 Wave* Wave::Superpose(const ConstWaves& displacement, Interference* pattern)
 {
+	BIO_SANITIZE(pattern,,return this)
+
+	//Resolve each Superposition once for the whole batch, so that Noninterfering displacements never reach the virtual Superpose().
+	if (mSymmetry && pattern->GetSuperpositionFor(mSymmetry->GetId()) == superposition::Noninterfering())
+	{
+		return this;
+	}
+	::std::vector< Superposition > superpositions;
+	pattern->GetSuperpositionsFor(
+		displacement,
+		superpositions
+	);
+
+	Index position = 0;
 	for (
-		SmartIterator wav = displacement.Begin()++;
+		SmartIterator wav = displacement.Begin();
 		!wav.IsAfterEnd();
-		++wav
+		++wav, ++position
 		)
 	{
-		Superpose(wav.As< const Wave* >(), pattern);
+		if (superpositions[position] == superposition::Noninterfering())
+		{
+			continue; //Superpose would do nothing.
+		}
+		Superpose(
+			wav.As< const Wave* >(),
+			pattern);
 	}
 	return this;
 }